@@ -24,6 +24,7 @@
 # find opm -name '*.c*' -printf '\t%p\n' | sort
 list (APPEND MAIN_SOURCE_FILES
   ebos/collecttoiorank.cc
+  ebos/eclcostpartitioner.cc
   ebos/eclgenericcpgridvanguard.cc
   ebos/eclgenericoutputblackoilmodule.cc
   ebos/eclgenericproblem.cc
@@ -58,6 +59,8 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/utils/gatherDeferredLogger.cpp
   opm/simulators/utils/ParallelFileMerger.cpp
   opm/simulators/utils/ParallelRestart.cpp
+  opm/simulators/utils/PerformanceTrace.cpp
+  opm/simulators/utils/SimulatorCheckpoint.cpp
   opm/simulators/wells/ALQState.cpp
   opm/simulators/wells/BlackoilWellModelGeneric.cpp
   opm/simulators/wells/GasLiftGroupInfo.cpp
@@ -116,8 +119,10 @@ if(HAVE_FPGA)
 endif()
 
 if(MPI_FOUND)
-  list(APPEND MAIN_SOURCE_FILES opm/simulators/utils/ParallelEclipseState.cpp
-                                opm/simulators/utils/ParallelSerialization.cpp)
+  list(APPEND MAIN_SOURCE_FILES opm/simulators/linalg/SharedMemoryHaloExchange.cpp
+                                opm/simulators/utils/ParallelEclipseState.cpp
+                                opm/simulators/utils/ParallelSerialization.cpp
+                                opm/simulators/utils/ParsedStateCache.cpp)
 endif()
 
 # originally generated with the command:
@@ -144,9 +149,12 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_wellstate.cpp
   tests/test_parallelwellinfo.cpp
   tests/test_glift1.cpp
+  tests/test_glift_gradqueue.cpp
   tests/test_keyword_validator.cpp
   tests/test_GroupState.cpp
   tests/test_ALQState.cpp
+  tests/test_linearsystemcapture.cpp
+  tests/test_nonlinearsolverebos.cpp
   )
 
 if(MPI_FOUND)
@@ -261,6 +269,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/GraphColoring.hpp
   opm/simulators/linalg/ISTLSolverEbos.hpp
   opm/simulators/linalg/ISTLSolverEbosFlexible.hpp
+  opm/simulators/linalg/LinearSystemCapture.hpp
   opm/simulators/linalg/MatrixBlock.hpp
   opm/simulators/linalg/MatrixMarketSpecializations.hpp
   opm/simulators/linalg/OwningBlockPreconditioner.hpp
@@ -273,6 +282,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/PreconditionerFactory.hpp
   opm/simulators/linalg/PreconditionerWithUpdate.hpp
   opm/simulators/linalg/PropertyTree.hpp
+  opm/simulators/linalg/SharedMemoryHaloExchange.hpp
   opm/simulators/linalg/WellOperators.hpp
   opm/simulators/linalg/WriteSystemMatrixHelper.hpp
   opm/simulators/linalg/findOverlapRowsAndColumns.hpp
@@ -293,6 +303,9 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/utils/moduleVersion.hpp
   opm/simulators/utils/ParallelEclipseState.hpp
   opm/simulators/utils/ParallelRestart.hpp
+  opm/simulators/utils/ParsedStateCache.hpp
+  opm/simulators/utils/PerformanceTrace.hpp
+  opm/simulators/utils/SimulatorCheckpoint.hpp
   opm/simulators/utils/PropsCentroidsDataHandle.hpp
   opm/simulators/wells/PerfData.hpp
   opm/simulators/wells/PerforationData.hpp
@@ -325,5 +338,6 @@ list (APPEND PUBLIC_HEADER_FILES
   )
 
 list (APPEND EXAMPLE_SOURCE_FILES
+  examples/flow_linsolve_bench.cpp
   examples/printvfp.cpp
   )
@@ -168,6 +168,45 @@ function(add_test_compare_parallel_restarted_simulation)
                        PROPERTIES RUN_SERIAL 1)
 endfunction()
 
+###########################################################################
+# TEST: add_test_compare_checkpointed_simulation
+###########################################################################
+
+# Input:
+#   - casename: basename (no extension)
+#   - interval: number of report steps between checkpoints
+#   - fault: optional box "I1 I2 J1 J2 K1 K2 FACE" of a fault added to the case,
+#            whose multiplier is changed by MULTFLT before the first checkpoint
+#
+# Details:
+#   - This test class compares the output from a simulation resumed from
+#     a checkpoint to that of an uninterrupted simulation.
+function(add_test_compare_checkpointed_simulation)
+  set(oneValueArgs CASENAME FILENAME SIMULATOR ABS_TOL REL_TOL DIR INTERVAL FAULT)
+  set(multiValueArgs TEST_ARGS)
+  cmake_parse_arguments(PARAM "$" "${oneValueArgs}" "${multiValueArgs}" ${ARGN} )
+  if(NOT PARAM_DIR)
+    set(PARAM_DIR ${PARAM_CASENAME})
+  endif()
+  set(TEST_NAME ${PARAM_SIMULATOR}+${PARAM_FILENAME})
+  if(PARAM_FAULT)
+    set(TEST_NAME ${TEST_NAME}_MULTFLT)
+  else()
+    set(PARAM_FAULT none)
+  endif()
+  set(RESULT_PATH ${BASE_RESULT_PATH}/checkpoint/${TEST_NAME})
+  opm_add_test(compareCheckpointedSim_${TEST_NAME} NO_COMPILE
+               EXE_NAME ${PARAM_SIMULATOR}
+               DRIVER_ARGS ${OPM_TESTS_ROOT}/${PARAM_DIR} ${RESULT_PATH}
+                           ${PROJECT_BINARY_DIR}/bin
+                           ${PARAM_FILENAME}
+                           ${PARAM_ABS_TOL} ${PARAM_REL_TOL}
+                           ${COMPARE_ECL_COMMAND}
+                           ${PARAM_INTERVAL}
+                           "${PARAM_FAULT}"
+               TEST_ARGS ${PARAM_TEST_ARGS})
+endfunction()
+
 if(NOT TARGET test-suite)
   add_custom_target(test-suite)
 endif()
@@ -934,6 +973,26 @@ add_test_compare_restarted_simulation(CASENAME msw_3d_hfa
                                       REL_TOL ${rel_tol_restart_msw}
                                       TEST_ARGS --enable-adaptive-time-stepping=false --sched-restart=true)
 
+# Checkpoint tests, checkpointing requires MPI
+if(MPI_FOUND)
+  opm_set_test_driver(${PROJECT_SOURCE_DIR}/tests/run-checkpoint-regressionTest.sh "")
+
+  add_test_compare_checkpointed_simulation(CASENAME spe1
+                                           FILENAME SPE1CASE2
+                                           SIMULATOR flow
+                                           ABS_TOL ${abs_tol}
+                                           REL_TOL ${rel_tol}
+                                           INTERVAL 40)
+
+  add_test_compare_checkpointed_simulation(CASENAME spe1
+                                           FILENAME SPE1CASE2
+                                           SIMULATOR flow
+                                           ABS_TOL ${abs_tol}
+                                           REL_TOL ${rel_tol}
+                                           INTERVAL 40
+                                           FAULT "5 5 1 10 1 3 X")
+endif()
+
 # PORV test
 opm_set_test_driver(${PROJECT_SOURCE_DIR}/tests/run-porv-acceptanceTest.sh "")
 add_test_compareECLFiles(CASENAME norne
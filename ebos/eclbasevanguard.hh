@@ -72,6 +72,10 @@ struct SchedRestart {
     using type = UndefinedProperty;
 };
 template<class TypeTag, class MyTypeTag>
+struct EclParsedStateCacheDir {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
 struct EclOutputInterval {
     using type = UndefinedProperty;
 };
@@ -103,6 +107,31 @@ struct AllowDistributedWells {
     using type = UndefinedProperty;
 };
 
+template<class TypeTag, class MyTypeTag>
+struct CostBasedPartitioning {
+    using type = UndefinedProperty;
+};
+
+template<class TypeTag, class MyTypeTag>
+struct PartitionPerforationCost {
+    using type = UndefinedProperty;
+};
+
+template<class TypeTag, class MyTypeTag>
+struct PartitionSegmentCost {
+    using type = UndefinedProperty;
+};
+
+template<class TypeTag, class MyTypeTag>
+struct PartitionCellCostFile {
+    using type = UndefinedProperty;
+};
+
+template<class TypeTag, class MyTypeTag>
+struct PartitionMaxImbalance {
+    using type = UndefinedProperty;
+};
+
 template<class TypeTag>
 struct IgnoreKeywords<TypeTag, TTag::EclBaseVanguard> {
     static constexpr auto value = "";
@@ -128,6 +157,10 @@ struct SchedRestart<TypeTag, TTag::EclBaseVanguard> {
     static constexpr bool value = true;
 };
 template<class TypeTag>
+struct EclParsedStateCacheDir<TypeTag, TTag::EclBaseVanguard> {
+    static constexpr auto value = "";
+};
+template<class TypeTag>
 struct EdgeWeightsMethod<TypeTag, TTag::EclBaseVanguard> {
     static constexpr int value = 1;
 };
@@ -150,6 +183,31 @@ struct AllowDistributedWells<TypeTag, TTag::EclBaseVanguard> {
     static constexpr bool value = false;
 };
 
+template<class TypeTag>
+struct CostBasedPartitioning<TypeTag, TTag::EclBaseVanguard> {
+    static constexpr bool value = false;
+};
+
+template<class TypeTag>
+struct PartitionPerforationCost<TypeTag, TTag::EclBaseVanguard> {
+    static constexpr double value = 10.0;
+};
+
+template<class TypeTag>
+struct PartitionSegmentCost<TypeTag, TTag::EclBaseVanguard> {
+    static constexpr double value = 2.0;
+};
+
+template<class TypeTag>
+struct PartitionCellCostFile<TypeTag, TTag::EclBaseVanguard> {
+    static constexpr auto value = "";
+};
+
+template<class TypeTag>
+struct PartitionMaxImbalance<TypeTag, TTag::EclBaseVanguard> {
+    static constexpr double value = 1.5;
+};
+
 template<class T1, class T2>
 struct UseMultisegmentWell;
 
@@ -207,6 +265,8 @@ public:
                              "Use strict mode for parsing - all errors are collected before the applicaton exists.");
         EWOMS_REGISTER_PARAM(TypeTag, bool, SchedRestart,
                              "When restarting: should we try to initialize wells and groups from historical SCHEDULE section.");
+        EWOMS_REGISTER_PARAM(TypeTag, std::string, EclParsedStateCacheDir,
+                             "Directory for a binary cache of the parsed deck and schedule, reused while the input files are unchanged. Empty disables the cache.");
         EWOMS_REGISTER_PARAM(TypeTag, int, EdgeWeightsMethod,
                              "Choose edge-weighing strategy: 0=uniform, 1=trans, 2=log(trans).");
         EWOMS_REGISTER_PARAM(TypeTag, bool, OwnerCellsFirst,
@@ -217,6 +277,17 @@ public:
                              "Tolerable imbalance of the loadbalancing provided by Zoltan (default: 1.1).");
         EWOMS_REGISTER_PARAM(TypeTag, bool, AllowDistributedWells,
                              "Allow the perforations of a well to be distributed to interior of multiple processes");
+        EWOMS_REGISTER_PARAM(TypeTag, bool, CostBasedPartitioning,
+                             "Partition the grid by an estimated cost per cell instead of using Zoltan. Columns and the cells of each well are kept on one process.");
+        EWOMS_REGISTER_PARAM(TypeTag, double, PartitionPerforationCost,
+                             "Cost of a well perforation relative to a cell for cost based partitioning");
+        EWOMS_REGISTER_PARAM(TypeTag, double, PartitionSegmentCost,
+                             "Cost of a multisegment well segment relative to a cell for cost based partitioning");
+        EWOMS_REGISTER_PARAM(TypeTag, std::string, PartitionCellCostFile,
+                             "File with measured costs per cell from a previous run (written as <CASE>.CELLCOST with cost based partitioning) used by cost based partitioning");
+        EWOMS_REGISTER_PARAM(TypeTag, double, PartitionMaxImbalance,
+                             "Largest estimated imbalance (max/avg cost) accepted from cost based partitioning, "
+                             "the default partitioning is used otherwise");
         // register here for the use in the tests without BlackoildModelParametersEbos
         EWOMS_REGISTER_PARAM(TypeTag, bool, UseMultisegmentWell, "Use the well model for multi-segment wells instead of the one for single-segment wells");
 
@@ -237,8 +308,14 @@ public:
         serialPartitioning_ = EWOMS_GET_PARAM(TypeTag, bool, SerialPartitioning);
         zoltanImbalanceTol_ = EWOMS_GET_PARAM(TypeTag, double, ZoltanImbalanceTol);
         enableDistributedWells_ = EWOMS_GET_PARAM(TypeTag, bool, AllowDistributedWells);
+        costBasedPartitioning_ = EWOMS_GET_PARAM(TypeTag, bool, CostBasedPartitioning);
+        partitionPerforationCost_ = EWOMS_GET_PARAM(TypeTag, double, PartitionPerforationCost);
+        partitionSegmentCost_ = EWOMS_GET_PARAM(TypeTag, double, PartitionSegmentCost);
+        partitionCellCostFile_ = EWOMS_GET_PARAM(TypeTag, std::string, PartitionCellCostFile);
+        partitionMaxImbalance_ = EWOMS_GET_PARAM(TypeTag, double, PartitionMaxImbalance);
         ignoredKeywords_ = EWOMS_GET_PARAM(TypeTag, std::string, IgnoreKeywords);
         eclStrictParsing_ = EWOMS_GET_PARAM(TypeTag, bool, EclStrictParsing);
+        parsedStateCacheDir_ = EWOMS_GET_PARAM(TypeTag, std::string, EclParsedStateCacheDir);
         int output_param = EWOMS_GET_PARAM(TypeTag, int, EclOutputInterval);
         if (output_param >= 0)
             outputInterval_ = output_param;
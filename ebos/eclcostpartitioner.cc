@@ -0,0 +1,312 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+#include <config.h>
+#include <ebos/eclcostpartitioner.hh>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/MSW/WellSegments.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Well/Well.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Well/WellConnections.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+
+struct ColumnGroup
+{
+    double i = 0.0;
+    double j = 0.0;
+    double cost = 0.0;
+};
+
+int findRoot(std::vector<int>& parent, int idx)
+{
+    while (parent[idx] != idx) {
+        parent[idx] = parent[parent[idx]];
+        idx = parent[idx];
+    }
+    return idx;
+}
+
+// Recursive coordinate bisection of the column groups in [begin, end) into
+// numParts parts starting at firstPart. There are at least numParts groups,
+// every part gets at least one of them.
+void bisect(std::vector<int>::iterator begin,
+            std::vector<int>::iterator end,
+            const std::vector<ColumnGroup>& groups,
+            int firstPart,
+            int numParts,
+            std::vector<int>& groupPart)
+{
+    if (numParts == 1) {
+        for (auto it = begin; it != end; ++it)
+            groupPart[*it] = firstPart;
+        return;
+    }
+
+    // split perpendicular to the longer extent
+    auto [minI, maxI] = std::minmax_element(begin, end, [&groups](int a, int b)
+                                            { return groups[a].i < groups[b].i; });
+    auto [minJ, maxJ] = std::minmax_element(begin, end, [&groups](int a, int b)
+                                            { return groups[a].j < groups[b].j; });
+    const bool alongI = groups[*maxI].i - groups[*minI].i >= groups[*maxJ].j - groups[*minJ].j;
+    std::sort(begin, end, [&groups, alongI](int a, int b)
+              { return alongI ? groups[a].i < groups[b].i : groups[a].j < groups[b].j; });
+
+    const int leftParts = numParts / 2;
+    const double total = std::accumulate(begin, end, 0.0, [&groups](double sum, int g)
+                                         { return sum + groups[g].cost; });
+    const double target = total * leftParts / numParts;
+
+    auto mid = begin;
+    double leftCost = 0.0;
+    while (mid != end && leftCost + 0.5 * groups[*mid].cost < target) {
+        leftCost += groups[*mid].cost;
+        ++mid;
+    }
+    // both halves need at least one group per part
+    mid = std::clamp(mid, begin + leftParts, end - (numParts - leftParts));
+
+    bisect(begin, mid, groups, firstPart, leftParts, groupPart);
+    bisect(mid, end, groups, firstPart + leftParts, numParts - leftParts, groupPart);
+}
+
+} // anonymous namespace
+
+namespace Opm {
+
+std::vector<double> eclCellCosts(const Dune::CpGrid& grid,
+                                 const std::vector<Well>& wells,
+                                 const EclCellCostModel& model)
+{
+    const auto& globalCell = grid.globalCell();
+    const int numCells = grid.size(0);
+    std::vector<double> costs(numCells, 1.0);
+
+    if (!model.measuredCostFile.empty()) {
+        std::ifstream is(model.measuredCostFile);
+        if (!is)
+            throw std::runtime_error(fmt::format("Could not open cell cost file '{}'",
+                                                 model.measuredCostFile));
+
+        std::unordered_map<int, double> measured;
+        std::string line;
+        while (std::getline(is, line)) {
+            if (line.empty() || line[0] == '#')
+                continue;
+            std::istringstream ls(line);
+            int cartIdx;
+            double cost;
+            if (ls >> cartIdx >> cost)
+                measured[cartIdx] = cost;
+        }
+
+        // normalize to an average cost of one over the cells found in the file
+        double sum = 0.0;
+        int found = 0;
+        for (int cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            auto it = measured.find(globalCell[cellIdx]);
+            if (it != measured.end()) {
+                sum += it->second;
+                ++found;
+            }
+        }
+        if (found > 0 && sum > 0.0) {
+            const double scale = found / sum;
+            for (int cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+                auto it = measured.find(globalCell[cellIdx]);
+                if (it != measured.end())
+                    costs[cellIdx] = it->second * scale;
+            }
+        }
+        if (found < numCells)
+            OpmLog::warning(fmt::format("No measured cost for {} of {} cells in '{}', "
+                                        "using the average cost for these",
+                                        numCells - found, numCells, model.measuredCostFile));
+    }
+
+    // additional cost of the perforated cells, per Cartesian index
+    std::unordered_map<int, double> wellCost;
+    for (const auto& well : wells) {
+        const auto& connections = well.getConnections();
+        if (connections.size() == 0)
+            continue;
+
+        const double segmentCostPerConnection = well.isMultiSegment()
+            ? model.segmentCost * well.getSegments().size() / connections.size()
+            : 0.0;
+        for (const auto& connection : connections)
+            wellCost[connection.global_index()] += model.perforationCost + segmentCostPerConnection;
+    }
+    if (!wellCost.empty()) {
+        for (int cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            auto it = wellCost.find(globalCell[cellIdx]);
+            if (it != wellCost.end())
+                costs[cellIdx] += it->second;
+        }
+    }
+
+    return costs;
+}
+
+std::vector<int> eclCostBasedPartition(const Dune::CpGrid& grid,
+                                       const std::vector<Well>& wells,
+                                       const EclCellCostModel& model,
+                                       int numParts)
+{
+    const auto& globalCell = grid.globalCell();
+    const auto& cartDims = grid.logicalCartesianSize();
+    const int numCells = grid.size(0);
+    const int columnSize = cartDims[0] * cartDims[1];
+
+    const std::vector<double> costs = eclCellCosts(grid, wells, model);
+
+    // one group per active column ...
+    std::vector<int> columnGroup(columnSize, -1);
+    int numGroups = 0;
+    for (int cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        int& group = columnGroup[globalCell[cellIdx] % columnSize];
+        if (group < 0)
+            group = numGroups++;
+    }
+
+    // ... where the columns perforated by the same well are merged
+    std::vector<int> parent(numGroups);
+    std::iota(parent.begin(), parent.end(), 0);
+    for (const auto& well : wells) {
+        int first = -1;
+        for (const auto& connection : well.getConnections()) {
+            const int group = columnGroup[connection.global_index() % columnSize];
+            if (group < 0)
+                continue; // column without active cells
+            const int root = findRoot(parent, group);
+            if (first < 0)
+                first = root;
+            else if (root != first)
+                parent[root] = first;
+        }
+    }
+
+    // cost and cost weighted center of each merged group
+    std::vector<ColumnGroup> groups(numGroups);
+    for (int cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        const int column = globalCell[cellIdx] % columnSize;
+        auto& group = groups[findRoot(parent, columnGroup[column])];
+        group.i += costs[cellIdx] * (column % cartDims[0]);
+        group.j += costs[cellIdx] * (column / cartDims[0]);
+        group.cost += costs[cellIdx];
+    }
+
+    std::vector<int> roots;
+    for (int group = 0; group < numGroups; ++group) {
+        if (findRoot(parent, group) != group)
+            continue;
+        groups[group].i /= groups[group].cost;
+        groups[group].j /= groups[group].cost;
+        roots.push_back(group);
+    }
+
+    if (static_cast<int>(roots.size()) < numParts) {
+        OpmLog::warning(fmt::format("Cost based partitioning needs at least one group of columns "
+                                    "per process, but the columns form only {} groups when keeping "
+                                    "wells together. Using the default partitioning instead",
+                                    roots.size()));
+        return {};
+    }
+
+    std::vector<int> groupPart(numGroups, 0);
+    bisect(roots.begin(), roots.end(), groups, 0, numParts, groupPart);
+
+    std::vector<int> parts(numCells);
+    std::vector<double> partCost(numParts, 0.0);
+    for (int cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        parts[cellIdx] = groupPart[findRoot(parent, columnGroup[globalCell[cellIdx] % columnSize])];
+        partCost[parts[cellIdx]] += costs[cellIdx];
+    }
+
+    const double totalCost = std::accumulate(partCost.begin(), partCost.end(), 0.0);
+    const double maxCost = *std::max_element(partCost.begin(), partCost.end());
+    const double imbalance = totalCost > 0.0 ? maxCost * numParts / totalCost : 1.0;
+    if (imbalance > model.maxImbalance) {
+        // typically a group of columns connected by wells that is more
+        // expensive than the average part
+        OpmLog::warning(fmt::format("Estimated imbalance {:.3f} of cost based partitioning "
+                                    "into {} parts exceeds {:.3f}. Using the default "
+                                    "partitioning instead",
+                                    imbalance, numParts, model.maxImbalance));
+        return {};
+    }
+    OpmLog::info(fmt::format("Cost based partitioning into {} parts, "
+                             "estimated imbalance (max/avg): {:.3f}",
+                             numParts, imbalance));
+
+    return parts;
+}
+
+void writeEclCellCosts(const Dune::CollectiveCommunication<Dune::MPIHelper::MPICommunicator>& comm,
+                       const std::vector<int>& cartesianIndices,
+                       const std::vector<double>& costs,
+                       const std::string& filename)
+{
+    const int size = comm.size();
+    int localSize = cartesianIndices.size();
+    std::vector<int> sizes(size);
+    comm.gather(&localSize, sizes.data(), 1, 0);
+    std::vector<int> offsets(size + 1, 0);
+    std::partial_sum(sizes.begin(), sizes.end(), offsets.begin() + 1);
+
+    const bool isRoot = comm.rank() == 0;
+    std::vector<int> allIndices(isRoot ? std::max(offsets.back(), 1) : 1);
+    std::vector<double> allCosts(allIndices.size());
+    comm.gatherv(cartesianIndices.data(), localSize, allIndices.data(),
+                 sizes.data(), offsets.data(), 0);
+    comm.gatherv(costs.data(), localSize, allCosts.data(),
+                 sizes.data(), offsets.data(), 0);
+
+    if (!isRoot)
+        return;
+
+    std::vector<int> order(offsets.back());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&allIndices](int a, int b)
+              { return allIndices[a] < allIndices[b]; });
+
+    std::ofstream os(filename);
+    if (!os) {
+        OpmLog::warning(fmt::format("Could not write cell cost file '{}'", filename));
+        return;
+    }
+    os << "# cartesian_index cost\n";
+    for (int idx : order)
+        os << allIndices[idx] << ' ' << allCosts[idx] << '\n';
+}
+
+} // namespace Opm
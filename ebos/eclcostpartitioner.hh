@@ -0,0 +1,98 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Partitioning of the simulation grid based on an estimate of the
+ *        computational cost of each cell.
+ */
+#ifndef EWOMS_ECL_COST_PARTITIONER_HH
+#define EWOMS_ECL_COST_PARTITIONER_HH
+
+#include <opm/grid/CpGrid.hpp>
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class Well;
+
+/*!
+ * \brief Parameters of the cost model used for cost based partitioning.
+ *
+ * The cost of a cell is one, or its measured cost from a previous run
+ * normalized to an average of one, plus perforationCost for each well
+ * perforation in the cell and segmentCost times the number of segments of
+ * a multisegment well distributed over the perforated cells of the well.
+ * A partition with a larger estimated imbalance than maxImbalance is
+ * rejected.
+ */
+struct EclCellCostModel
+{
+    double perforationCost = 10.0;
+    double segmentCost = 2.0;
+    std::string measuredCostFile;
+    double maxImbalance = 1.5;
+};
+
+/*!
+ * \brief Compute the cost of each cell of a global grid.
+ */
+std::vector<double> eclCellCosts(const Dune::CpGrid& grid,
+                                 const std::vector<Well>& wells,
+                                 const EclCellCostModel& model);
+
+/*!
+ * \brief Partition a global grid into parts of roughly equal cost.
+ *
+ * The vertical columns of the grid and the perforated cells of each well
+ * are kept together, the columns are split by recursive coordinate
+ * bisection in the logical Cartesian (i,j) plane.
+ *
+ * \return The part of each cell, or an empty vector if the grouped columns
+ *         cannot be split into numParts non-empty parts with an estimated
+ *         imbalance below EclCellCostModel::maxImbalance.
+ */
+std::vector<int> eclCostBasedPartition(const Dune::CpGrid& grid,
+                                       const std::vector<Well>& wells,
+                                       const EclCellCostModel& model,
+                                       int numParts);
+
+/*!
+ * \brief Write measured cell costs to a file suitable for
+ *        EclCellCostModel::measuredCostFile.
+ *
+ * Collective, every process passes the Cartesian indices of its interior
+ * cells and their cost, the file is written by rank 0.
+ */
+void writeEclCellCosts(const Dune::CollectiveCommunication<Dune::MPIHelper::MPICommunicator>& comm,
+                       const std::vector<int>& cartesianIndices,
+                       const std::vector<double>& costs,
+                       const std::string& filename);
+
+} // namespace Opm
+
+#endif
@@ -33,6 +33,9 @@
 #include "ecltransmissibility.hh"
 #include "femcpgridcompat.hh"
 #include "eclgenericcpgridvanguard.hh"
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace Opm {
 template <class TypeTag>
@@ -131,11 +134,19 @@ public:
     void loadBalance()
     {
 #if HAVE_MPI
+        std::optional<EclCellCostModel> costModel;
+        if (this->costBasedPartitioning()) {
+            costModel = EclCellCostModel{this->partitionPerforationCost(),
+                                         this->partitionSegmentCost(),
+                                         this->partitionCellCostFile(),
+                                         this->partitionMaxImbalance()};
+        }
         this->doLoadBalance_(this->edgeWeightsMethod(), this->ownersFirst(),
                              this->serialPartitioning(), this->enableDistributedWells(),
                              this->zoltanImbalanceTol(), this->gridView(),
                              this->schedule(), this->centroids_,
-                             this->eclState(), this->parallelWells_);
+                             this->eclState(), this->parallelWells_,
+                             costModel ? &*costModel : nullptr);
 #endif
 
         this->allocCartMapper();
@@ -149,6 +160,26 @@ public:
 #endif
     }
 
+    /*!
+     * \brief Write the measured cost of the interior cells of this process
+     *        to a file, for the cost based partitioning of later runs.
+     *
+     * Collective, costs has one entry per element of the local grid view.
+     */
+    void writeCellCosts(const std::vector<double>& costs, const std::string& filename) const
+    {
+        std::vector<int> cartesianIndices;
+        std::vector<double> interiorCosts;
+        const auto& gridView = this->gridView();
+        auto elemIt = gridView.template begin</*codim=*/0, Dune::Interior_Partition>();
+        const auto& elemEndIt = gridView.template end</*codim=*/0, Dune::Interior_Partition>();
+        for (; elemIt != elemEndIt; ++elemIt) {
+            const unsigned elemIdx = gridView.indexSet().index(*elemIt);
+            cartesianIndices.push_back(this->cartesianIndex(elemIdx));
+            interiorCosts.push_back(costs[elemIdx]);
+        }
+        writeEclCellCosts(this->grid().comm(), cartesianIndices, interiorCosts, filename);
+    }
 
 protected:
     void createGrids_()
@@ -226,28 +226,21 @@ protected:
 
         Scalar trans = problem.transmissibility(elemCtx, interiorDofIdx_, exteriorDofIdx_);
         Scalar faceArea = scvf.area();
-        Scalar thpres = problem.thresholdPressure(I, J);
+        Scalar thpres = problem.thresholdPressure(elemCtx, interiorDofIdx_, exteriorDofIdx_);
 
         // estimate the gravity correction: for performance reasons we use a simplified
         // approach for this flux module that assumes that gravity is constant and always
         // acts into the downwards direction. (i.e., no centrifuge experiments, sorry.)
-        Scalar g = elemCtx.problem().gravity()[dimWorld - 1];
+        //
+        // the depth difference between the DOFs (i.e., the additional depth of the
+        // exterior DOF) times the gravity constant is cached by the problem. The depths
+        // are not the Z coordinates of the element centroids but the problem's
+        // dofCenterDepth(), because ECL seems to like to be inconsistent on that front.
+        Scalar distZg = problem.depthDifferenceGravity(elemCtx, interiorDofIdx_, exteriorDofIdx_);
 
         const auto& intQuantsIn = elemCtx.intensiveQuantities(interiorDofIdx_, timeIdx);
         const auto& intQuantsEx = elemCtx.intensiveQuantities(exteriorDofIdx_, timeIdx);
 
-        // this is quite hacky because the dune grid interface does not provide a
-        // cellCenterDepth() method (so we ask the problem to provide it). The "good"
-        // solution would be to take the Z coordinate of the element centroids, but since
-        // ECL seems to like to be inconsistent on that front, it needs to be done like
-        // here...
-        Scalar zIn = problem.dofCenterDepth(elemCtx, interiorDofIdx_, timeIdx);
-        Scalar zEx = problem.dofCenterDepth(elemCtx, exteriorDofIdx_, timeIdx);
-
-        // the distances from the DOF's depths. (i.e., the additional depth of the
-        // exterior DOF)
-        Scalar distZ = zIn - zEx;
-
         for (unsigned phaseIdx=0; phaseIdx < numPhases; phaseIdx++) {
             if (!FluidSystem::phaseIsActive(phaseIdx))
                 continue;
@@ -274,9 +267,9 @@ protected:
             Evaluation pressureExterior = Toolbox::value(intQuantsEx.fluidState().pressure(phaseIdx));
             if (enableExtbo) // added stability; particulary useful for solvent migrating in pure water
                              // where the solvent fraction displays a 0/1 behaviour ...
-                pressureExterior += Toolbox::value(rhoAvg)*(distZ*g);
+                pressureExterior += Toolbox::value(rhoAvg)*distZg;
             else
-                pressureExterior += rhoAvg*(distZ*g);
+                pressureExterior += rhoAvg*distZg;
 
             pressureDifference_[phaseIdx] = pressureExterior - pressureInterior;
 
@@ -47,8 +47,10 @@
 #include <fmt/format.h>
 
 #include <cassert>
+#include <exception>
 #include <numeric>
 #include <sstream>
+#include <utility>
 
 namespace Opm {
 
@@ -82,16 +84,46 @@ void EclGenericCpGridVanguard<ElementMapper,GridView,Scalar>::doLoadBalance_(Dun
                                                                              const Schedule& schedule,
                                                                              std::vector<double>& centroids,
                                                                              EclipseState& eclState1,
-                                                                             EclGenericVanguard::ParallelWellStruct& parallelWells)
+                                                                             EclGenericVanguard::ParallelWellStruct& parallelWells,
+                                                                             const EclCellCostModel* costModel)
 {
     int mpiSize = 1;
     MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
 
     if (mpiSize > 1) {
+        int loadBalancerSet = externalLoadBalancer.has_value();
+        grid_->comm().broadcast(&loadBalancerSet, 1, 0);
+
+        // a cost based partition that cannot be balanced falls back to Zoltan
+        std::vector<int> costParts;
+        if (!loadBalancerSet && costModel != nullptr) {
+            if (grid_->comm().rank() == 0) {
+                // errors, e.g. an unreadable cell cost file, must not leave the
+                // other processes waiting in the broadcast below
+                try {
+                    costParts = eclCostBasedPartition(*grid_, schedule.getWellsatEnd(), *costModel, mpiSize);
+                }
+                catch (const std::exception& e) {
+                    OpmLog::warning(fmt::format("Cost based partitioning failed: {}. "
+                                                "Using the default partitioning instead", e.what()));
+                    costParts.clear();
+                }
+            }
+            loadBalancerSet = !costParts.empty();
+            grid_->comm().broadcast(&loadBalancerSet, 1, 0);
+        }
+
         // the CpGrid's loadBalance() method likes to have the transmissibilities as
         // its edge weights. since this is (kind of) a layering violation and
         // transmissibilities are relatively expensive to compute, we only do it if
-        // more than a single process is involved in the simulation.
+        // more than a single process is involved in the simulation. The global
+        // transmissibilities are always computed here, as the INIT output needs
+        // them and the field properties are only available for the global grid
+        // before they are distributed below. Only the loop assembling the per
+        // face edge weights is skipped if the partitioner does not use them, i.e.
+        // for an external or cost based partition and for uniform edge weights.
+        const bool transEdgeWeights = !loadBalancerSet
+            && edgeWeightsMethod != Dune::EdgeWeightMethod::uniform;
         cartesianIndexMapper_.reset(new CartesianIndexMapper(*grid_));
         if (grid_->size(0))
         {
@@ -104,10 +136,10 @@ void EclGenericCpGridVanguard<ElementMapper,GridView,Scalar>::doLoadBalance_(Dun
         const auto& gridView = grid_->leafGridView();
         unsigned numFaces = grid_->numFaces();
         std::vector<double> faceTrans;
-        int loadBalancerSet = externalLoadBalancer.has_value();
-        grid_->comm().broadcast(&loadBalancerSet, 1, 0);
-        if (!loadBalancerSet){
+        if (!loadBalancerSet) {
             faceTrans.resize(numFaces, 0.0);
+        }
+        if (transEdgeWeights) {
             ElementMapper elemMapper(gridv, Dune::mcmgElementLayout());
             auto elemIt = gridView.template begin</*codim=*/0>();
             const auto& elemEndIt = gridView.template end</*codim=*/0>();
@@ -152,7 +184,10 @@ void EclGenericCpGridVanguard<ElementMapper,GridView,Scalar>::doLoadBalance_(Dun
                     std::vector<int> parts;
                     if (grid_->comm().rank() == 0)
                     {
-                        parts =  (*externalLoadBalancer)(*grid_);
+                        if (externalLoadBalancer)
+                            parts = (*externalLoadBalancer)(*grid_);
+                        else
+                            parts = std::move(costParts);
                     }
                     parallelWells = std::get<1>(grid_->loadBalance(handle, parts, &wells, ownersFirst, false, 1));
                 }
@@ -27,6 +27,7 @@
 #ifndef EWOMS_ECL_CP_GRID_GENERIC_VANGUARD_HH
 #define EWOMS_ECL_CP_GRID_GENERIC_VANGUARD_HH
 
+#include <ebos/eclcostpartitioner.hh>
 #include <ebos/eclgenericvanguard.hh>
 #include <opm/grid/CpGrid.hpp>
 
@@ -114,7 +115,8 @@ protected:
                         const GridView& gridv, const Schedule& schedule,
                         std::vector<double>& centroids,
                         EclipseState& eclState,
-                        EclGenericVanguard::ParallelWellStruct& parallelWells);
+                        EclGenericVanguard::ParallelWellStruct& parallelWells,
+                        const EclCellCostModel* costModel);
 
     void distributeFieldProps_(EclipseState& eclState);
 #endif
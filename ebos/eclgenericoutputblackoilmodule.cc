@@ -37,6 +37,7 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/SummaryState.hpp>
 #include <opm/parser/eclipse/Units/Units.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <initializer_list>
 #include <iomanip>
@@ -776,36 +777,6 @@ setRestart(const data::Solution& sol,
         ppcw_[elemIdx] = sol.data("PPCW")[globalDofIndex];
 }
 
-template<class FluidSystem,class Scalar>
-typename EclGenericOutputBlackoilModule<FluidSystem,Scalar>::ScalarBuffer
-EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
-regionSum(const ScalarBuffer& property,
-          const std::vector<int>& regionId,
-          size_t maxNumberOfRegions,
-          const Comm& comm)
-{
-        ScalarBuffer totals(maxNumberOfRegions, 0.0);
-
-        if (property.empty())
-            return totals;
-
-        assert(regionId.size() == property.size());
-        for (size_t j = 0; j < regionId.size(); ++j) {
-            const int regionIdx = regionId[j] - 1;
-            // the cell is not attributed to any region. ignore it!
-            if (regionIdx < 0)
-                continue;
-
-            assert(regionIdx < static_cast<int>(maxNumberOfRegions));
-            totals[regionIdx] += property[j];
-        }
-
-        for (size_t i = 0; i < maxNumberOfRegions; ++i)
-            totals[i] = comm.sum(totals[i]);
-
-        return totals;
-    }
-
 template<class FluidSystem, class Scalar>
 void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
 doAllocBuffers(unsigned bufferSize,
@@ -813,6 +784,7 @@ doAllocBuffers(unsigned bufferSize,
                const bool substep,
                const bool log,
                const bool isRestart,
+               const bool summaryOnly,
                const bool vapparsActive,
                const bool enableHysteresis,
                unsigned numTracers)
@@ -896,11 +868,18 @@ doAllocBuffers(unsigned bufferSize,
         }
     }
 
+    // Each restart field is only computed for the step it is requested
+    // at. Fields left over from reading the restart file or from a step
+    // which was not written would otherwise be updated for every cell in
+    // all subsequent time steps.
+    this->clearRestartFields_();
+
     // field data should be allocated
     // 1) when we want to restart
     // 2) when it is ask for by the user via restartConfig
     // 3) when it is not a substep
-    if (!isRestart && (!schedule_.write_rst_file(reportStepNum, log) || substep))
+    // 4) when the cell data is not only used to evaluate the summary
+    if (!isRestart && (!schedule_.write_rst_file(reportStepNum, log) || substep || summaryOnly))
         return;
 
     // always output saturation of active phases
@@ -1078,6 +1057,36 @@ doAllocBuffers(unsigned bufferSize,
 
 }
 
+template<class FluidSystem, class Scalar>
+void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
+clearRestartFields_()
+{
+    for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+        saturation_[phaseIdx].clear();
+        invB_[phaseIdx].clear();
+        density_[phaseIdx].clear();
+        viscosity_[phaseIdx].clear();
+        relativePermeability_[phaseIdx].clear();
+    }
+
+    for (auto* buffer : {&oilPressure_, &temperature_, &rs_, &rv_,
+                         &sSol_, &cPolymer_, &cFoam_, &cSalt_,
+                         &extboX_, &extboY_, &extboZ_,
+                         &mFracOil_, &mFracGas_, &mFracCo2_,
+                         &soMax_, &pcSwMdcOw_, &krnSwMdcOw_, &pcSwMdcGo_, &krnSwMdcGo_,
+                         &ppcw_, &gasDissolutionFactor_, &oilVaporizationFactor_,
+                         &bubblePointPressure_, &dewPointPressure_,
+                         &rockCompPorvMultiplier_, &rockCompTransMultiplier_,
+                         &swMax_, &minimumOilPressure_, &overburdenPressure_,
+                         &gasFormationVolumeFactor_, &saturatedOilFormationVolumeFactor_,
+                         &oilSaturationPressure_})
+    {
+        buffer->clear();
+    }
+
+    tracerConcentrations_.clear();
+}
+
 template<class FluidSystem, class Scalar>
 void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
 fipUnitConvert_(std::unordered_map<Inplace::Phase, Scalar>& fip) const
@@ -1470,15 +1479,6 @@ outputFipLogImpl(const Inplace& inplace) const
     }
 }
 
-template<class FluidSystem,class Scalar>
-int EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
-regionMax(const std::vector<int>& region,
-          const Comm& comm)
-{
-    const auto max_value = region.empty() ? 0 : *std::max_element(region.begin(), region.end());
-    return comm.max(max_value);
-}
-
 template<class FluidSystem,class Scalar>
 void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
 update(Inplace& inplace,
@@ -1497,51 +1497,89 @@ update(Inplace& inplace,
 }
 
 template<class FluidSystem,class Scalar>
-void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
-makeRegionSum(Inplace& inplace,
-              const std::string& region_name,
-              const Comm& comm) const
+Inplace EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
+accumulateRegionSums(const Comm& comm)
 {
-    const auto& region = this->regions_.at(region_name);
-    const std::size_t ntFip = this->regionMax(region, comm);
-
-    auto update_inplace =
-        [&inplace, &region, &region_name, &comm, ntFip, this]
-        (const Inplace::Phase       phase,
-         const std::vector<Scalar>& value)
-    {
-        update(inplace, region_name, phase, ntFip,
-               this->regionSum(value, region, ntFip, comm));
+    // All region sets and quantities are accumulated in a single pass over
+    // the cells into one dense buffer, which is then reduced by a single
+    // collective call instead of one call per region, quantity and region
+    // set. The iteration order must be the same on all processes.
+    std::vector<std::string> regionNames;
+    regionNames.reserve(this->regions_.size());
+    for (const auto& region : this->regions_)
+        regionNames.push_back(region.first);
+    // FIPNUM goes last, such that the field totals are the FIPNUM sums
+    std::sort(regionNames.begin(), regionNames.end(),
+              [](const std::string& a, const std::string& b)
+              { return std::make_pair(a == "FIPNUM", a) < std::make_pair(b == "FIPNUM", b); });
+
+    std::vector<std::pair<Inplace::Phase, const ScalarBuffer*>> quantities {
+        {Inplace::Phase::PressurePV, &this->pressureTimesPoreVolume_},
+        {Inplace::Phase::HydroCarbonPV, &this->hydrocarbonPoreVolume_},
+        {Inplace::Phase::PressureHydroCarbonPV, &this->pressureTimesHydrocarbonVolume_},
+        {Inplace::Phase::DynamicPoreVolume, &this->dynamicPoreVolume_},
     };
+    for (const auto& phase : Inplace::phases()) {
+        auto fipPos = this->fip_.find(phase);
+        if (fipPos != this->fip_.end())
+            quantities.emplace_back(phase, &fipPos->second);
+    }
+    const std::size_t numQuantities = quantities.size();
+
+    std::vector<const std::vector<int>*> regions;
+    std::vector<int> ntFip;
+    for (const auto& name : regionNames) {
+        const auto& region = this->regions_.at(name);
+        regions.push_back(&region);
+        ntFip.push_back(region.empty() ? 0 : *std::max_element(region.begin(), region.end()));
+    }
+    if (!ntFip.empty())
+        comm.max(ntFip.data(), ntFip.size());
+
+    // totals[offset[r] + q*ntFip[r] + regionIdx] for region set r and quantity q
+    std::vector<std::size_t> offset(regions.size() + 1, 0);
+    for (std::size_t r = 0; r < regions.size(); ++r)
+        offset[r + 1] = offset[r] + numQuantities * ntFip[r];
+    std::vector<double> totals(offset.back(), 0.0);
+
+    std::size_t numCells = 0;
+    for (const auto* region : regions)
+        numCells = std::max(numCells, region->size());
+
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        for (std::size_t r = 0; r < regions.size(); ++r) {
+            const auto& region = *regions[r];
+            if (cellIdx >= region.size())
+                continue;
 
-    update_inplace(Inplace::Phase::PressurePV,
-                   this->pressureTimesPoreVolume_);
-
-    update_inplace(Inplace::Phase::HydroCarbonPV,
-                   this->hydrocarbonPoreVolume_);
-
-    update_inplace(Inplace::Phase::PressureHydroCarbonPV,
-                   this->pressureTimesHydrocarbonVolume_);
+            const int regionIdx = region[cellIdx] - 1;
+            // the cell is not attributed to any region. ignore it!
+            if (regionIdx < 0)
+                continue;
 
-    update_inplace(Inplace::Phase::DynamicPoreVolume,
-                   this->dynamicPoreVolume_);
+            assert(regionIdx < ntFip[r]);
+            double* regionTotals = totals.data() + offset[r] + regionIdx;
+            for (std::size_t q = 0; q < numQuantities; ++q) {
+                const auto& property = *quantities[q].second;
+                if (property.empty())
+                    continue;
 
-    for (const auto& phase : Inplace::phases()) {
-        auto fipPos = this->fip_.find(phase);
-        if (fipPos != this->fip_.end()) {
-            update_inplace(phase, fipPos->second);
+                assert(property.size() == region.size());
+                regionTotals[q * ntFip[r]] += property[cellIdx];
+            }
         }
     }
-}
 
-template<class FluidSystem,class Scalar>
-Inplace EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
-accumulateRegionSums(const Comm& comm)
-{
-    Inplace inplace;
+    if (!totals.empty())
+        comm.sum(totals.data(), totals.size());
 
-    for (const auto& region : this->regions_) {
-        makeRegionSum(inplace, region.first, comm);
+    Inplace inplace;
+    for (std::size_t r = 0; r < regions.size(); ++r) {
+        for (std::size_t q = 0; q < numQuantities; ++q) {
+            const auto begin = totals.begin() + offset[r] + q * ntFip[r];
+            update(inplace, regionNames[r], quantities[q].first, ntFip[r],
+                   ScalarBuffer(begin, begin + ntFip[r]));
+        }
     }
 
     // The first time the outputFipLog function is run we store the inplace values in
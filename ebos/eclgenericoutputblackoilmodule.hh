@@ -32,7 +32,9 @@
 #include <numeric>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <opm/output/data/Wells.hpp>
 #include <opm/output/eclipse/Inplace.hpp>
@@ -140,6 +142,58 @@ public:
         return this->initialInplace_.value();
     }
 
+    /// Checkpointing of the initial fluid in place, which the fluid in
+    /// place reports refer to. The values are stored as entries of region
+    /// set, region number, phase and value, region number zero holding the
+    /// field totals.
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        bool hasInitialInplace = this->initialInplace_.has_value();
+        std::vector<std::string> regionSets;
+        std::vector<std::size_t> regionNumbers;
+        std::vector<int> phases;
+        std::vector<double> values;
+        if (serializer.isSerializing() && hasInitialInplace) {
+            const auto& inplace = *this->initialInplace_;
+            auto addEntry = [&](const std::string& regionSet, std::size_t regionNumber,
+                                Inplace::Phase phase, double value)
+            {
+                regionSets.push_back(regionSet);
+                regionNumbers.push_back(regionNumber);
+                phases.push_back(static_cast<int>(phase));
+                values.push_back(value);
+            };
+            for (const auto& phase : Inplace::phases()) {
+                if (inplace.has(phase))
+                    addEntry("", 0, phase, inplace.get(phase));
+                for (const auto& region : this->regions_) {
+                    for (std::size_t reg = 1; inplace.has(region.first, phase, reg); ++reg)
+                        addEntry(region.first, reg, phase, inplace.get(region.first, phase, reg));
+                }
+            }
+        }
+        serializer(hasInitialInplace);
+        serializer(regionSets);
+        serializer(regionNumbers);
+        serializer(phases);
+        serializer(values);
+        if (!serializer.isSerializing()) {
+            this->initialInplace_.reset();
+            if (hasInitialInplace) {
+                Inplace inplace;
+                for (std::size_t i = 0; i < values.size(); ++i) {
+                    const auto phase = static_cast<Inplace::Phase>(phases[i]);
+                    if (regionNumbers[i] == 0)
+                        inplace.add(phase, values[i]);
+                    else
+                        inplace.add(regionSets[i], phase, regionNumbers[i], values[i]);
+                }
+                this->initialInplace_ = std::move(inplace);
+            }
+        }
+    }
+
     // Virtual destructor for safer inheritance.
     virtual ~EclGenericOutputBlackoilModule() = default;
 
@@ -236,10 +290,13 @@ protected:
                         const bool substep,
                         const bool log,
                         const bool isRestart,
+                        const bool summaryOnly,
                         const bool vapparsActive,
                         const bool enableHysteresis,
                         unsigned numTracers);
 
+    void clearRestartFields_();
+
     void fipUnitConvert_(std::unordered_map<Inplace::Phase, Scalar>& fip) const;
 
     void pressureUnitConvert_(Scalar& pav) const;
@@ -259,10 +316,6 @@ protected:
 
     void outputFipLogImpl(const Inplace& inplace) const;
 
-    void makeRegionSum(Inplace& inplace,
-                       const std::string& region_name,
-                       const Comm& comm) const;
-
     Inplace accumulateRegionSums(const Comm& comm);
 
     void updateSummaryRegionValues(const Inplace& inplace,
@@ -282,15 +335,6 @@ protected:
                                          const ScalarBuffer& pressurePv,
                                          const ScalarBuffer& pv,
                                          bool hydrocarbon);
-    // Sum Fip values over regions.
-    static ScalarBuffer regionSum(const ScalarBuffer& property,
-                                  const std::vector<int>& regionId,
-                                  const std::size_t maxNumberOfRegions,
-                                  const Comm& comm);
-
-    static int regionMax(const std::vector<int>& region,
-                         const Comm& comm);
-
     static void update(Inplace& inplace,
                        const std::string& region_name,
                        const Inplace::Phase phase,
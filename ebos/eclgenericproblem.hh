@@ -188,6 +188,27 @@ public:
 
     bool vapparsActive(int episodeIdx) const;
 
+    /*!
+     * \brief Checkpointing of the history dependent per cell and per region
+     *        quantities.
+     */
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(maxOilSaturation_);
+        serializer(maxPolymerAdsorption_);
+        serializer(maxWaterSaturation_);
+        serializer(minOilPressure_);
+        serializer(polymerConcentration_);
+        serializer(polymerMoleWeight_);
+        serializer(solventSaturation_);
+        serializer(lastRv_);
+        serializer(maxDRv_);
+        serializer(convectiveDrs_);
+        serializer(lastRs_);
+        serializer(maxDRs_);
+    }
+
 protected:
     bool drsdtActive_(int episodeIdx) const;
     bool drvdtActive_(int episodeIdx) const;
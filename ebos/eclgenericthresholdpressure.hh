@@ -102,8 +102,8 @@ protected:
     std::vector<Scalar> thpresftValues_;
     std::vector<int> cartElemFaultIdx_;
 
-    bool enableThresholdPressure_;
-    bool enableExperiments_;
+    bool enableThresholdPressure_ = false;
+    bool enableExperiments_ = false;
 };
 
 } // namespace Opm
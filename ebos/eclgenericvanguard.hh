@@ -250,6 +250,36 @@ public:
     bool enableDistributedWells() const
     { return enableDistributedWells_; }
 
+    /*!
+     * \brief Whether the grid is partitioned by an estimated cost per cell.
+     */
+    bool costBasedPartitioning() const
+    { return costBasedPartitioning_; }
+
+    /*!
+     * \brief Cost of a well perforation relative to a cell for cost based partitioning.
+     */
+    double partitionPerforationCost() const
+    { return partitionPerforationCost_; }
+
+    /*!
+     * \brief Cost of a multisegment well segment relative to a cell for cost based partitioning.
+     */
+    double partitionSegmentCost() const
+    { return partitionSegmentCost_; }
+
+    /*!
+     * \brief File with measured costs per cell for cost based partitioning.
+     */
+    const std::string& partitionCellCostFile() const
+    { return partitionCellCostFile_; }
+
+    /*!
+     * \brief Largest estimated imbalance accepted from cost based partitioning.
+     */
+    double partitionMaxImbalance() const
+    { return partitionMaxImbalance_; }
+
     /*!
      * \brief Returns vector with name and whether the has local perforated cells
      *        for all wells.
@@ -285,8 +315,14 @@ protected:
     bool serialPartitioning_;
     double zoltanImbalanceTol_;
     bool enableDistributedWells_;
+    bool costBasedPartitioning_;
+    double partitionPerforationCost_;
+    double partitionSegmentCost_;
+    std::string partitionCellCostFile_;
+    double partitionMaxImbalance_;
     std::string ignoredKeywords_;
     bool eclStrictParsing_;
+    std::string parsedStateCacheDir_;
     std::optional<int> outputInterval_;
     bool useMultisegmentWell_;
     bool enableExperiments_;
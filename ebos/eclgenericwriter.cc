@@ -30,16 +30,21 @@
 #include <opm/grid/utility/cartesianToCompressed.hpp>
 
 #include <opm/output/eclipse/EclipseIO.hpp>
+#include <opm/output/eclipse/Inplace.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
 #include <opm/output/eclipse/Summary.hpp>
 
 #include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Action/Actions.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Action/State.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/SummaryState.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQState.hpp>
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
 
+#include <opm/simulators/utils/PerformanceTrace.hpp>
+
 #include <dune/grid/common/mcmgmapper.hh>
 
 #if HAVE_DUNE_FEM
@@ -149,6 +154,132 @@ struct EclWriteTasklet : public Opm::TaskletInterface
     }
 };
 
+// Evaluates the summary vectors and the UDQs of a time step into the given
+// states.
+void evalSummaryAndUDQ(const Opm::out::Summary& summary,
+                       const Opm::Schedule& schedule,
+                       int reportStepNum,
+                       double secondsElapsed,
+                       const std::map<std::size_t, double>& wbpData,
+                       const Opm::data::Wells& wellData,
+                       const Opm::data::GroupAndNetworkValues& groupAndNetworkData,
+                       const std::map<int, Opm::data::AquiferData>& aquiferData,
+                       const std::map<std::pair<std::string, int>, double>& blockData,
+                       const std::map<std::string, double>& miscSummaryData,
+                       const std::map<std::string, std::vector<double>>& regionData,
+                       const Opm::Inplace& inplace,
+                       const Opm::Inplace& initialInPlace,
+                       Opm::SummaryState& summaryState,
+                       Opm::UDQState& udqState)
+{
+    auto wbp_calculators = summary.wbp_calculators(reportStepNum);
+
+    for (const auto& [global_index, pressure] : wbpData)
+        wbp_calculators.add_pressure( global_index, pressure );
+
+    summary.eval(summaryState,
+                 reportStepNum,
+                 secondsElapsed,
+                 wellData,
+                 groupAndNetworkData,
+                 miscSummaryData,
+                 initialInPlace,
+                 inplace,
+                 wbp_calculators,
+                 regionData,
+                 blockData,
+                 aquiferData);
+
+    /*
+      Off-by-one-fun: The reportStepNum argument corresponds to the
+      report step these results will be written to, whereas the argument
+      to UDQ function evaluation corresponds to the report step we are
+      currently on.
+    */
+    auto udq_step = reportStepNum - 1;
+    const auto& udq_config = schedule.getUDQConfig(udq_step);
+    udq_config.eval( udq_step, schedule.wellMatcher(udq_step), summaryState, udqState);
+}
+
+// Summary evaluation on a thread of its own. The tasklet owns a copy of all
+// input data, the simulator can thus go on with the next time step while
+// the summary vectors of this one are evaluated. It only writes to the
+// summary and UDQ states, which the restart write tasklets copy when they
+// are created, so it may run concurrently with them.
+struct EclSummaryTasklet : public Opm::TaskletInterface
+{
+    const Opm::out::Summary& summary_;
+    const Opm::Schedule& schedule_;
+    int reportStepNum_;
+    double secondsElapsed_;
+    std::map<std::size_t, double> wbpData_;
+    Opm::data::Wells wellData_;
+    Opm::data::GroupAndNetworkValues groupAndNetworkData_;
+    std::map<int, Opm::data::AquiferData> aquiferData_;
+    std::map<std::pair<std::string, int>, double> blockData_;
+    std::map<std::string, double> miscSummaryData_;
+    std::map<std::string, std::vector<double>> regionData_;
+    Opm::Inplace inplace_;
+    Opm::Inplace initialInPlace_;
+    Opm::SummaryState& summaryState_;
+    Opm::UDQState& udqState_;
+
+    explicit EclSummaryTasklet(const Opm::out::Summary& summary,
+                               const Opm::Schedule& schedule,
+                               int reportStepNum,
+                               double secondsElapsed,
+                               const std::map<std::size_t, double>& wbpData,
+                               const Opm::data::Wells& wellData,
+                               const Opm::data::GroupAndNetworkValues& groupAndNetworkData,
+                               const std::map<int, Opm::data::AquiferData>& aquiferData,
+                               const std::map<std::pair<std::string, int>, double>& blockData,
+                               const std::map<std::string, double>& miscSummaryData,
+                               const std::map<std::string, std::vector<double>>& regionData,
+                               const Opm::Inplace& inplace,
+                               const Opm::Inplace& initialInPlace,
+                               Opm::SummaryState& summaryState,
+                               Opm::UDQState& udqState)
+        : summary_(summary)
+        , schedule_(schedule)
+        , reportStepNum_(reportStepNum)
+        , secondsElapsed_(secondsElapsed)
+        , wbpData_(wbpData)
+        , wellData_(wellData)
+        , groupAndNetworkData_(groupAndNetworkData)
+        , aquiferData_(aquiferData)
+        , blockData_(blockData)
+        , miscSummaryData_(miscSummaryData)
+        , regionData_(regionData)
+        , inplace_(inplace)
+        , initialInPlace_(initialInPlace)
+        , summaryState_(summaryState)
+        , udqState_(udqState)
+    { }
+
+    void run()
+    {
+        OPM_TRACE_SCOPE("summary_eval");
+        evalSummaryAndUDQ(summary_, schedule_, reportStepNum_, secondsElapsed_,
+                          wbpData_, wellData_, groupAndNetworkData_, aquiferData_,
+                          blockData_, miscSummaryData_, regionData_,
+                          inplace_, initialInPlace_, summaryState_, udqState_);
+    }
+};
+
+// Whether the simulation itself reads the summary state, through ACTIONX
+// conditions or UDQs, at any report step.
+bool simulationUsesSummaryState(const Opm::Schedule& schedule)
+{
+    for (std::size_t step = 0; step < schedule.size(); ++step) {
+        const auto& udq_config = schedule.getUDQConfig(step);
+        if (!schedule[step].actions().empty() ||
+            !udq_config.definitions().empty() ||
+            !udq_config.assignments().empty())
+            return true;
+    }
+    return false;
+}
+
 }
 
 namespace Opm {
@@ -201,6 +332,27 @@ EclGenericWriter(const Schedule& schedule,
     if (enableAsyncOutput && collectToIORank_.isIORank())
         numWorkerThreads = 1;
     taskletRunner_.reset(new TaskletRunner(numWorkerThreads));
+
+    // The summary vectors are evaluated on a separate thread unless
+    // the simulation depends on them. This is decided identically on all
+    // processes, as it determines whether the summary state is broadcast.
+    asyncSummary_ = enableAsyncOutput && !simulationUsesSummaryState(schedule_);
+
+    // waiting for the summary evaluation then never waits for a restart file
+    // write queued on the output thread
+    summaryTaskletRunner_.reset(new TaskletRunner(asyncSummary_ ? numWorkerThreads : 0));
+}
+
+template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
+void EclGenericWriter<Grid,EquilGrid,GridView,ElementMapper,Scalar>::
+waitForSummary()
+{
+    if (!summaryPending_)
+        return;
+
+    OPM_TRACE_SCOPE("summary_wait");
+    summaryTaskletRunner_->barrier();
+    summaryPending_ = false;
 }
 
 template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
@@ -399,6 +551,7 @@ doWriteOutput(const int                     reportStepNum,
               Scalar nextStepSize,
               bool doublePrecision)
 {
+    OPM_TRACE_SCOPE("output_write");
     const auto isParallel = this->collectToIORank_.isParallel();
 
     RestartValue restartValue {
@@ -425,6 +578,9 @@ doWriteOutput(const int                     reportStepNum,
         restartValue.addExtra("OPMEXTRA", std::vector<double>(1, nextStepSize));
     }
 
+    // the tasklet copies the summary state, its evaluation must be finished
+    this->waitForSummary();
+
     // first, create a tasklet to write the data for the current time
     // step to disk
     auto eclWriteTasklet = std::make_shared<EclWriteTasklet>(
@@ -456,14 +612,30 @@ evalSummary(int reportStepNum,
             const Inplace& inplace,
             const Inplace& initialInPlace)
 {
+    if (asyncSummary_) {
+        // Nothing but the output depends on the summary state, it is thus
+        // only evaluated on the I/O rank and without a broadcast. At most
+        // one evaluation is in flight, the previous one is waited for.
+        if (collectToIORank_.isIORank()) {
+            const bool isParallel = this->collectToIORank_.isParallel();
+            auto summaryTasklet = std::make_shared<EclSummaryTasklet>(
+                eclIO_->summary(), schedule_, reportStepNum, curTime, wbpData,
+                isParallel ? this->collectToIORank_.globalWellData() : localWellData,
+                isParallel ? this->collectToIORank_.globalGroupAndNetworkData() : localGroupAndNetworkData,
+                isParallel ? this->collectToIORank_.globalAquiferData() : localAquiferData,
+                blockData, miscSummaryData, regionData, inplace, initialInPlace,
+                summaryState, udqState);
+
+            this->waitForSummary();
+            this->summaryTaskletRunner_->dispatch(std::move(summaryTasklet));
+            summaryPending_ = true;
+        }
+        return;
+    }
+
+    OPM_TRACE_SCOPE("summary_eval");
     std::vector<char> buffer;
     if (collectToIORank_.isIORank()) {
-        const auto& summary = eclIO_->summary();
-        auto wbp_calculators = summary.wbp_calculators(reportStepNum);
-
-        for (const auto& [global_index, pressure] : wbpData)
-            wbp_calculators.add_pressure( global_index, pressure );
-
         const auto& wellData = this->collectToIORank_.isParallel()
             ? this->collectToIORank_.globalWellData()
             : localWellData;
@@ -476,28 +648,10 @@ evalSummary(int reportStepNum,
             ? this->collectToIORank_.globalAquiferData()
             : localAquiferData;
 
-        summary.eval(summaryState,
-                     reportStepNum,
-                     curTime,
-                     wellData,
-                     groupAndNetworkData,
-                     miscSummaryData,
-                     initialInPlace,
-                     inplace,
-                     wbp_calculators,
-                     regionData,
-                     blockData,
-                     aquiferData);
-
-        /*
-          Off-by-one-fun: The reportStepNum argument corresponds to the
-          report step these results will be written to, whereas the argument
-          to UDQ function evaluation corresponds to the report step we are
-          currently on.
-        */
-        auto udq_step = reportStepNum - 1;
-        const auto& udq_config = schedule_.getUDQConfig(udq_step);
-        udq_config.eval( udq_step, schedule_.wellMatcher(udq_step), summaryState, udqState);
+        evalSummaryAndUDQ(eclIO_->summary(), schedule_, reportStepNum, curTime,
+                          wbpData, wellData, groupAndNetworkData, aquiferData,
+                          blockData, miscSummaryData, regionData,
+                          inplace, initialInPlace, summaryState, udqState);
 
         buffer = summaryState.serialize();
     }
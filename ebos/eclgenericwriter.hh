@@ -36,6 +36,7 @@
 #include <cstddef>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -80,6 +81,10 @@ public:
         globalTrans_ = globalTrans;
     }
 
+    //! \brief Waits until a summary evaluation on the summary thread has
+    //!        completed, i.e. the summary and UDQ states are up to date.
+    void waitForSummary();
+
 protected:
     const TransmissibilityType& globalTrans() const;
 
@@ -119,12 +124,17 @@ protected:
     const SummaryConfig& summaryConfig_;
     std::unique_ptr<EclipseIO> eclIO_;
     std::unique_ptr<TaskletRunner> taskletRunner_;
+    std::unique_ptr<TaskletRunner> summaryTaskletRunner_;
     Scalar restartTimeStepSize_;
     const TransmissibilityType* globalTrans_ = nullptr;
     const Dune::CartesianIndexMapper<Grid>& cartMapper_;
     const Dune::CartesianIndexMapper<EquilGrid>* equilCartMapper_;
     const EquilGrid* equilGrid_;
     std::vector<std::size_t> wbp_index_list_;
+    // evaluate the summary on a separate thread, only done if the
+    // simulation itself does not depend on the summary state
+    bool asyncSummary_ = false;
+    bool summaryPending_ = false;
 
 private:
     data::Solution computeTrans_(const std::unordered_map<int,int>& cartesianToActive) const;
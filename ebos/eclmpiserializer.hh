@@ -22,8 +22,13 @@
 #define ECL_MPI_SERIALIZER_HH
 
 #include <opm/simulators/utils/ParallelRestart.hpp>
+
+#include <algorithm>
+#include <limits>
 #include <optional>
+#include <stdexcept>
 #include <variant>
+#include <vector>
 
 namespace Opm {
 
@@ -40,6 +45,42 @@ public:
         m_comm(comm)
     {}
 
+#if HAVE_MPI
+    //! \brief Constructor with an explicit grouping of the processes into nodes.
+    //! \param comm The global communicator to broadcast using
+    //! \param nodeComm A split of comm into groups of processes which share
+    //!                 memory, e.g. to emulate several nodes on one machine.
+    //!                 The communicator is duplicated.
+    EclMpiSerializer(Dune::CollectiveCommunication<Dune::MPIHelper::MPICommunicator> comm,
+                     MPI_Comm nodeComm) :
+        m_comm(comm)
+    {
+        MPI_Comm_dup(nodeComm, &m_nodeComm);
+    }
+#endif
+
+    EclMpiSerializer(const EclMpiSerializer&) = delete;
+    EclMpiSerializer& operator=(const EclMpiSerializer&) = delete;
+
+    ~EclMpiSerializer()
+    {
+#if HAVE_MPI
+        int finalized = 0;
+        MPI_Finalized(&finalized);
+        if (finalized)
+            return;
+
+        if (m_window != MPI_WIN_NULL) {
+            MPI_Win_unlock_all(m_window);
+            MPI_Win_free(&m_window);
+        }
+        if (m_leaderComm != MPI_COMM_NULL)
+            MPI_Comm_free(&m_leaderComm);
+        if (m_nodeComm != MPI_COMM_NULL)
+            MPI_Comm_free(&m_nodeComm);
+#endif
+    }
+
     //! \brief (De-)serialization for simple types.
     //! \details The data handled by this depends on the underlying serialization used.
     //!          Currently you can call this for scalars, and stl containers with scalars.
@@ -292,46 +333,48 @@ public:
     }
 
     //! \brief Call this to serialize data.
-    //! \tparam T Type of class to serialize
-    //! \param data Class to serialize
-    template<class T>
-    void pack(T& data)
+    //! \tparam Args Types of classes to serialize
+    //! \param data Classes to serialize, packed one after the other into one buffer
+    template<class... Args>
+    void pack(Args&... data)
     {
         m_op = Operation::PACKSIZE;
         m_packSize = 0;
-        data.serializeOp(*this);
+        (data.serializeOp(*this), ...);
         m_position = 0;
         m_buffer.resize(m_packSize);
         m_op = Operation::PACK;
-        data.serializeOp(*this);
+        (data.serializeOp(*this), ...);
     }
 
     //! \brief Call this to de-serialize data.
-    //! \tparam T Type of class to de-serialize
-    //! \param data Class to de-serialize
-    template<class T>
-    void unpack(T& data)
+    //! \tparam Args Types of classes to de-serialize
+    //! \param data Classes to de-serialize, in the order they were packed
+    template<class... Args>
+    void unpack(Args&... data)
     {
         m_position = 0;
         m_op = Operation::UNPACK;
-        data.serializeOp(*this);
+        (data.serializeOp(*this), ...);
     }
 
     //! \brief Serialize and broadcast on root process, de-serialize on others.
-    //! \tparam T Type of class to broadcast
-    //! \param data Class to broadcast
-    template<class T>
-    void broadcast(T& data)
+    //! \details All objects are packed into a single buffer which is broadcast
+    //!          once, see broadcastBuffer_() for how it is distributed.
+    //! \tparam Args Types of classes to broadcast
+    //! \param data Classes to broadcast
+    template<class... Args>
+    void broadcast(Args&... data)
     {
         if (m_comm.size() == 1)
             return;
 
         if (m_comm.rank() == 0) {
             try {
-                pack(data);
+                pack(data...);
                 m_packSize = m_position;
                 m_comm.broadcast(&m_packSize, 1, 0);
-                m_comm.broadcast(m_buffer.data(), m_position, 0);
+                broadcastBuffer_();
             } catch (...) {
                 m_packSize = std::numeric_limits<size_t>::max();
                 m_comm.broadcast(&m_packSize, 1, 0);
@@ -343,8 +386,8 @@ public:
                 throw std::runtime_error("Error detected in parallel serialization");
             }
             m_buffer.resize(m_packSize);
-            m_comm.broadcast(m_buffer.data(), m_packSize, 0);
-            unpack(data);
+            broadcastBuffer_();
+            unpack(data...);
         }
     }
 
@@ -354,6 +397,20 @@ public:
         return m_position;
     }
 
+    //! \brief Returns the buffer holding the serialized data.
+    const std::vector<char>& buffer() const
+    {
+        return m_buffer;
+    }
+
+    //! \brief Replaces the buffer, e.g. with serialized data read from a file.
+    //! \details Call unpack() afterwards to de-serialize the data.
+    void setBuffer(std::vector<char> buffer)
+    {
+        m_buffer = std::move(buffer);
+        m_packSize = m_buffer.size();
+    }
+
     //! \brief Returns true if we are currently doing a serialization operation.
     bool isSerializing() const
     {
@@ -476,12 +533,118 @@ protected:
         static constexpr bool value = sizeof(test<T>(0)) == sizeof(yes_type);
     };
 
+    //! \brief Distribute the packed buffer from the root process to all others.
+    //! \details The buffer only travels once to each node: it is broadcast
+    //!          between one leader process per node into a node-local shared
+    //!          memory window, from which the other processes on the node
+    //!          copy it. Large buffers are broadcast as a pipeline of
+    //!          non-blocking chunks. The communicators and the window are
+    //!          set up on the first broadcast and reused by later ones.
+    void broadcastBuffer_()
+    {
+#if HAVE_MPI
+        const int rank = m_comm.rank();
+        setupNodeCommunication_();
+
+        if (m_nodeSize == 1) {
+            chunkedBroadcast_(m_buffer.data(), m_packSize, m_leaderComm);
+            return;
+        }
+
+        // all processes of a node know the size, the window is thus
+        // reallocated collectively
+        if (m_packSize > m_windowSize) {
+            if (m_window != MPI_WIN_NULL) {
+                MPI_Win_unlock_all(m_window);
+                MPI_Win_free(&m_window);
+            }
+            MPI_Win_allocate_shared(m_nodeRank == 0 ? static_cast<MPI_Aint>(m_packSize) : 0, 1,
+                                    MPI_INFO_NULL, m_nodeComm, &m_shared, &m_window);
+            if (m_nodeRank != 0) {
+                MPI_Aint size;
+                int dispUnit;
+                MPI_Win_shared_query(m_window, 0, &size, &dispUnit, &m_shared);
+            }
+            MPI_Win_lock_all(MPI_MODE_NOCHECK, m_window);
+            m_windowSize = m_packSize;
+        }
+
+        if (m_leaderComm != MPI_COMM_NULL) {
+            if (rank == 0)
+                std::copy_n(m_buffer.data(), m_packSize, m_shared);
+            chunkedBroadcast_(m_shared, m_packSize, m_leaderComm);
+        }
+        MPI_Win_sync(m_window);
+        MPI_Barrier(m_nodeComm);
+        MPI_Win_sync(m_window);
+        // the leaders of the other nodes received the buffer in the window too
+        if (rank != 0)
+            std::copy_n(m_shared, m_packSize, m_buffer.data());
+        // nobody may overwrite the window before all have copied it
+        MPI_Barrier(m_nodeComm);
+#endif
+    }
+
+#if HAVE_MPI
+    //! \brief Creates the node and the node leader communicators.
+    void setupNodeCommunication_()
+    {
+        if (m_nodeSize > 0)
+            return;
+
+        const int rank = m_comm.rank();
+        if (m_nodeComm == MPI_COMM_NULL)
+            MPI_Comm_split_type(m_comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &m_nodeComm);
+        MPI_Comm_rank(m_nodeComm, &m_nodeRank);
+        MPI_Comm_size(m_nodeComm, &m_nodeSize);
+
+        // The root process must lead its node. This holds for the shared memory
+        // split, which is ordered by rank, but not necessarily for a given one.
+        int rootLeads = m_nodeRank == 0;
+        MPI_Bcast(&rootLeads, 1, MPI_INT, 0, m_comm);
+        if (!rootLeads)
+            throw std::logic_error("The root process must have rank 0 on its node");
+
+        MPI_Comm_split(m_comm, m_nodeRank == 0 ? 0 : MPI_UNDEFINED, rank, &m_leaderComm);
+    }
+#endif
+
+#if HAVE_MPI
+    //! \brief Broadcast a buffer from rank zero of a communicator in chunks.
+    //! \details Does nothing on processes not part of the communicator.
+    static void chunkedBroadcast_(char* data, std::size_t size, MPI_Comm comm)
+    {
+        if (comm == MPI_COMM_NULL)
+            return;
+
+        constexpr std::size_t chunkSize = 64 * 1024 * 1024;
+        std::vector<MPI_Request> requests;
+        requests.reserve(size / chunkSize + 1);
+        for (std::size_t offset = 0; offset < size; offset += chunkSize) {
+            requests.emplace_back();
+            MPI_Ibcast(data + offset, static_cast<int>(std::min(chunkSize, size - offset)),
+                       MPI_CHAR, 0, comm, &requests.back());
+        }
+        MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    }
+#endif
+
     Dune::CollectiveCommunication<Dune::MPIHelper::MPICommunicator> m_comm; //!< Communicator to broadcast using
 
     Operation m_op = Operation::PACKSIZE; //!< Current operation
     size_t m_packSize = 0; //!< Required buffer size after PACKSIZE has been done
     int m_position = 0; //!< Current position in buffer
     std::vector<char> m_buffer; //!< Buffer for serialized data
+
+#if HAVE_MPI
+    MPI_Comm m_nodeComm = MPI_COMM_NULL; //!< Processes sharing memory with this one
+    MPI_Comm m_leaderComm = MPI_COMM_NULL; //!< First process of each node, null on the others
+    int m_nodeRank = 0; //!< Rank within the node
+    int m_nodeSize = 0; //!< Number of processes on the node, zero until set up
+    MPI_Win m_window = MPI_WIN_NULL; //!< Shared memory window of the node
+    char* m_shared = nullptr; //!< Start of the window of the node leader
+    std::size_t m_windowSize = 0; //!< Size of the window in bytes
+#endif
 };
 
 }
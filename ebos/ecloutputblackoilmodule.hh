@@ -160,8 +160,12 @@ public:
     /*!
      * \brief Allocate memory for the scalar fields we would like to
      *        write to ECL output files
+     *
+     * If summaryOnly is set, the cell data is only used to evaluate the
+     * summary vectors and no restart fields are allocated.
      */
-    void allocBuffers(unsigned bufferSize, unsigned reportStepNum, const bool substep, const bool log, const bool isRestart)
+    void allocBuffers(unsigned bufferSize, unsigned reportStepNum, const bool substep, const bool log, const bool isRestart,
+                      const bool summaryOnly = false)
     {
         if (!std::is_same<Discretization, EcfvDiscretization<TypeTag> >::value)
             return;
@@ -171,6 +175,7 @@ public:
                              substep,
                              log,
                              isRestart,
+                             summaryOnly,
                              simulator_.problem().vapparsActive(std::max(simulator_.episodeIndex(), 0)),
                              simulator_.problem().materialLawManager()->enableHysteresis(),
                              simulator_.problem().tracerModel().numTracers());
@@ -106,6 +106,7 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <memory>
 
 namespace Opm {
 template <class TypeTag>
@@ -633,6 +634,7 @@ class EclProblem : public GetPropType<TypeTag, Properties::BaseProblem>
     using Simulator = GetPropType<TypeTag, Properties::Simulator>;
     using Element = typename GridView::template Codim<0>::Entity;
     using ElementContext = GetPropType<TypeTag, Properties::ElementContext>;
+    using ThreadManager = GetPropType<TypeTag, Properties::ThreadManager>;
     using EclMaterialLawManager = typename GetProp<TypeTag, Properties::MaterialLaw>::EclMaterialLawManager;
     using EclThermalLawManager = typename GetProp<TypeTag, Properties::SolidEnergyLaw>::EclThermalLawManager;
     using MaterialLawParams = typename EclMaterialLawManager::MaterialLawParams;
@@ -983,11 +985,95 @@ public:
             aquiferModel_.serialize(res);
     }
 
+    /*!
+     * \brief Checkpointing of the history dependent state of the problem and
+     *        its well, aquifer and tracer models.
+     *
+     * The primary variables are not included, they belong to the model.
+     */
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        EclGenericProblem<GridView,FluidSystem,Scalar>::serializeOp(serializer);
+
+        // the summary state is checkpointed alongside, a summary evaluation
+        // on the output thread must not be in flight
+        if (eclWriter_)
+            eclWriter_->waitForSummary();
+
+        if (materialLawManager_->enableHysteresis()) {
+            const unsigned numElems = this->model().numGridDof();
+            std::vector<Scalar> hysteresis(4*numElems);
+            if (serializer.isSerializing()) {
+                for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
+                    materialLawManager_->oilWaterHysteresisParams(hysteresis[4*elemIdx],
+                                                                  hysteresis[4*elemIdx + 1],
+                                                                  elemIdx);
+                    materialLawManager_->gasOilHysteresisParams(hysteresis[4*elemIdx + 2],
+                                                                hysteresis[4*elemIdx + 3],
+                                                                elemIdx);
+                }
+            }
+            serializer(hysteresis);
+            if (!serializer.isSerializing()) {
+                for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
+                    materialLawManager_->setOilWaterHysteresisParams(hysteresis[4*elemIdx],
+                                                                     hysteresis[4*elemIdx + 1],
+                                                                     elemIdx);
+                    materialLawManager_->setGasOilHysteresisParams(hysteresis[4*elemIdx + 2],
+                                                                   hysteresis[4*elemIdx + 3],
+                                                                   elemIdx);
+                }
+            }
+        }
+
+        wellModel_.serializeOp(serializer);
+
+        if (enableAquifers_)
+            aquiferModel_.serializeOp(serializer);
+
+        tracerModel_.serializeOp(serializer);
+
+        // the initial fluid in place is kept by the output module, which
+        // only exists with output enabled
+        bool hasOutputModule = eclWriter_ != nullptr;
+        serializer(hasOutputModule);
+        if (hasOutputModule != (eclWriter_ != nullptr))
+            throw std::runtime_error("The checkpoint was written with a different output configuration");
+        if (eclWriter_)
+            eclWriter_->eclOutputModule().serializeOp(serializer);
+    }
+
     int episodeIndex() const
     {
         return std::max(this->simulator().episodeIndex(), 0);
     }
 
+    /*!
+     * \brief Apply the geometry modifying keywords of the SCHEDULE section of all
+     *        report steps before the given one.
+     *
+     * This is needed when continuing from a checkpoint, because the modified
+     * properties, transmissibilities and pore volumes are not part of it.
+     */
+    void applyGeoModifiersBefore(int episodeIdx)
+    {
+        auto& eclState = this->simulator().vanguard().eclState();
+        const auto& schedule = this->simulator().vanguard().schedule();
+        bool modified = false;
+        for (int step = 0; step < episodeIdx; ++step) {
+            if (schedule[step].events().hasEvent(ScheduleEvents::GEO_MODIFIER)) {
+                eclState.apply_geo_keywords(schedule[step].geo_keywords());
+                modified = true;
+            }
+        }
+        if (!modified)
+            return;
+
+        transmissibilities_.update(true);
+        updateGeoModifiedQuantities_();
+    }
+
     /*!
      * \brief Called by the simulator before an episode begins.
      */
@@ -1008,13 +1094,27 @@ public:
             // has changed, the grid may need be re-created which has some serious
             // implications on e.g., the solution of the simulation.)
             const auto& miniDeck = schedule[episodeIdx].geo_keywords();
+            const auto oldMultipliers = transmissibilities_.faceMultipliers();
             eclState.apply_geo_keywords( miniDeck );
 
-            // re-compute all quantities which may possibly be affected.
-            transmissibilities_.update(true);
-            this->referencePorosity_[1] = this->referencePorosity_[0];
-            updateReferencePorosity_();
-            updatePffDofData_();
+            // re-compute all quantities which may possibly be affected. if only
+            // face multipliers were modified, only the faces of the elements
+            // whose multipliers actually changed need to be recomputed.
+            const bool onlyFaceMultipliers =
+                std::all_of(miniDeck.begin(), miniDeck.end(),
+                            [](const auto& keyword)
+                            {
+                                static const std::set<std::string> faceKeywords {
+                                    "MULTFLT", "MULTX", "MULTX-", "MULTY", "MULTY-",
+                                    "MULTZ", "MULTZ-", "MULTPV", "BOX", "ENDBOX"
+                                };
+                                return faceKeywords.count(keyword.name()) > 0;
+                            });
+            if (onlyFaceMultipliers)
+                transmissibilities_.updateModifiedMultipliers(oldMultipliers);
+            else
+                transmissibilities_.update(true);
+            updateGeoModifiedQuantities_();
         }
 
         bool tuningEvent = this->beginEpisode_(enableExperiments, this->episodeIndex());
@@ -1051,17 +1151,11 @@ public:
                              this->simulator().timeStepSize(),
                              this->simulator().endTime());
 
-        // update maximum water saturation and minimum pressure
-        // used when ROCKCOMP is activated
-        const bool invalidateFromMaxWaterSat = updateMaxWaterSaturation_();
-        const bool invalidateFromMinPressure = updateMinPressure_();
-
-        // update hysteresis and max oil saturation used in vappars
-        const bool invalidateFromHyst = updateHysteresis_();
-        const bool invalidateFromMaxOilSat = updateMaxOilSaturation_();
+        // update maximum water saturation and minimum pressure used when ROCKCOMP
+        // is activated, hysteresis and max oil saturation used in vappars
+        const bool invalidateIntensiveQuantities = updateHistoryQuantities_();
 
         // the derivatives may have change
-        bool invalidateIntensiveQuantities = invalidateFromMaxWaterSat || invalidateFromMinPressure || invalidateFromHyst || invalidateFromMaxOilSat;
         if (invalidateIntensiveQuantities)
             this->model().invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
 
@@ -1409,6 +1503,35 @@ public:
     Scalar thresholdPressure(unsigned elem1Idx, unsigned elem2Idx) const
     { return thresholdPressures_.thresholdPressure(elem1Idx, elem2Idx); }
 
+    /*!
+     * \brief Returns the threshold pressure between the center DOF of a
+     *        context and one of its neighbors.
+     *
+     * In contrast to thresholdPressure(unsigned, unsigned), this uses the
+     * per face data cached in updatePffDofData_().
+     */
+    template <class Context>
+    Scalar thresholdPressure(const Context& context,
+                             [[maybe_unused]] unsigned fromDofLocalIdx,
+                             unsigned toDofLocalIdx) const
+    {
+        assert(fromDofLocalIdx == 0);
+        return pffDofData_.get(context.element(), toDofLocalIdx).thresholdPressure;
+    }
+
+    /*!
+     * \brief Returns the depth difference between the center DOF of a
+     *        context and one of its neighbors times the gravity constant.
+     */
+    template <class Context>
+    Scalar depthDifferenceGravity(const Context& context,
+                                  [[maybe_unused]] unsigned fromDofLocalIdx,
+                                  unsigned toDofLocalIdx) const
+    {
+        assert(fromDofLocalIdx == 0);
+        return pffDofData_.get(context.element(), toDofLocalIdx).dZg;
+    }
+
     const EclThresholdPressure<TypeTag>& thresholdPressure() const
     { return thresholdPressures_; }
 
@@ -1807,6 +1930,9 @@ public:
         // this point, because determining the threshold pressures may require to access
         // the initial solution.
         thresholdPressures_.finishInit();
+        thresholdPressuresInitialized_ = true;
+        // the threshold pressures are cached per face
+        updatePffDofData_();
 
         updateCompositionChangeLimits_();
 
@@ -2006,33 +2132,44 @@ public:
     }
 
 private:
+    // update the quantities derived from the properties which may be modified in
+    // the SCHEDULE section, after the transmissibilities have been updated
+    void updateGeoModifiedQuantities_()
+    {
+        this->referencePorosity_[1] = this->referencePorosity_[0];
+        updateReferencePorosity_();
+        updatePffDofData_();
+    }
+
     // update the parameters needed for DRSDT and DRVDT
     void updateCompositionChangeLimits_()
     {
-        // update the "last Rs" values for all elements, including the ones in the ghost
-        // and overlap regions
+        // update the "last Rs" and "last Rv" values for all elements, including the
+        // ones in the ghost and overlap regions
         const auto& simulator = this->simulator();
+        const auto& vanguard = simulator.vanguard();
         int episodeIdx = this->episodeIndex();
 
-        if (this->drsdtConvective_(episodeIdx)) {
-            // This implements the convective DRSDT as described in
-            // Sandve et al. "Convective dissolution in field scale CO2 storage simulations using the OPM Flow simulator"
-            // Submitted to TCCS 11, 2021
-            Scalar g = this->gravity_[dim - 1];
-            ElementContext elemCtx(simulator);
-            const auto& vanguard = simulator.vanguard();
-            auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-            const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-            for (; elemIt != elemEndIt; ++elemIt) {
-                const Element& elem = *elemIt;
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-                unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
+        const bool drsdtConvective = this->drsdtConvective_(episodeIdx);
+        const bool drsdtActive = this->drsdtActive_(episodeIdx);
+        const bool drvdtActive = this->drvdtActive_(episodeIdx);
+        if (!drsdtConvective && !drsdtActive && !drvdtActive)
+            return;
+
+        const auto& oilVaporizationControl = vanguard.schedule()[episodeIdx].oilvap();
+        Scalar g = this->gravity_[dim - 1];
+        forEachElementIntensiveQuantities_([&](unsigned compressedDofIdx, const IntensiveQuantities& iq)
+        {
+            const auto& fs = iq.fluidState();
+            using FluidState = typename std::decay<decltype(fs)>::type;
+
+            if (drsdtConvective) {
+                // This implements the convective DRSDT as described in
+                // Sandve et al. "Convective dissolution in field scale CO2 storage simulations using the OPM Flow simulator"
+                // Submitted to TCCS 11, 2021
                 const DimMatrix& perm = intrinsicPermeability(compressedDofIdx);
                 const Scalar permz = perm[dim - 1][dim - 1]; // The Z permeability
                 Scalar distZ = vanguard.cellThickness(compressedDofIdx);
-                const auto& iq = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& fs = iq.fluidState();
                 Scalar t = getValue(fs.temperature(FluidSystem::oilPhaseIdx));
                 Scalar p = getValue(fs.pressure(FluidSystem::oilPhaseIdx));
                 Scalar so = getValue(fs.saturation(FluidSystem::oilPhaseIdx));
@@ -2049,152 +2186,118 @@ private:
                 // i.e. we only allow for fingers moving downward
                 this->convectiveDrs_[compressedDofIdx] = permz * rssat * max(0.0, deltaDensity) * g / ( so * visc * distZ * poro);
             }
-        }
-
-        if (this->drsdtActive_(episodeIdx)) {
-            ElementContext elemCtx(simulator);
-            const auto& vanguard = simulator.vanguard();
-            auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-            const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-            for (; elemIt != elemEndIt; ++elemIt) {
-                const Element& elem = *elemIt;
-
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-
-                unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& iq = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& fs = iq.fluidState();
-
-                using FluidState = typename std::decay<decltype(fs)>::type;
 
+            if (drsdtActive) {
                 int pvtRegionIdx = this->pvtRegionIndex(compressedDofIdx);
-                const auto& oilVaporizationControl = simulator.vanguard().schedule()[episodeIdx].oilvap();
                 if (oilVaporizationControl.getOption(pvtRegionIdx) || fs.saturation(gasPhaseIdx) > freeGasMinSaturation_)
                     this->lastRs_[compressedDofIdx] =
                         BlackOil::template getRs_<FluidSystem,
                                                   FluidState,
-                                                 Scalar>(fs, iq.pvtRegionIndex());
+                                                  Scalar>(fs, iq.pvtRegionIndex());
                 else
                     this->lastRs_[compressedDofIdx] = std::numeric_limits<Scalar>::infinity();
             }
-        }
-
-        // update the "last Rv" values for all elements, including the ones in the ghost
-        // and overlap regions
-        if (this->drvdtActive_(episodeIdx)) {
-            ElementContext elemCtx(simulator);
-            const auto& vanguard = simulator.vanguard();
-            auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-            const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-            for (; elemIt != elemEndIt; ++elemIt) {
-                const Element& elem = *elemIt;
-
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-
-                unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& iq = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& fs = iq.fluidState();
-
-                using FluidState = typename std::decay<decltype(fs)>::type;
 
+            if (drvdtActive)
                 this->lastRv_[compressedDofIdx] =
                     BlackOil::template getRv_<FluidSystem,
                                               FluidState,
                                               Scalar>(fs, iq.pvtRegionIndex());
-            }
-        }
+        });
     }
 
-    bool updateMaxOilSaturation_()
+    // update the maximum oil and water saturations, the minimum pressure and the
+    // hysteresis parameters in a single pass over the grid. returns whether the
+    // intensive quantities need to be updated.
+    bool updateHistoryQuantities_()
     {
-        const auto& simulator = this->simulator();
-        int episodeIdx = this->episodeIndex();
-
         // we use VAPPARS
-        if (this->vapparsActive(episodeIdx)) {
-            ElementContext elemCtx(simulator);
-            const auto& vanguard = simulator.vanguard();
-            auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-            const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-            for (; elemIt != elemEndIt; ++elemIt) {
-                const Element& elem = *elemIt;
+        const bool updateMaxOilSaturation = this->vapparsActive(this->episodeIndex());
+        // water compaction is activated in ROCKCOMP
+        const bool updateMaxWaterSaturation = !this->maxWaterSaturation_.empty();
+        // IRREVERS option is used in ROCKCOMP
+        const bool updateMinPressure = !this->minOilPressure_.empty();
+        // we need to update the hysteresis data for _all_ elements (i.e., not just the
+        // interior ones) to avoid desynchronization of the processes in the parallel case!
+        const bool updateHysteresis = materialLawManager_->enableHysteresis();
 
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+        if (!updateMaxOilSaturation && !updateMaxWaterSaturation && !updateMinPressure && !updateHysteresis)
+            return false;
 
-                unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& iq = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& fs = iq.fluidState();
+        if (updateMaxWaterSaturation)
+            this->maxWaterSaturation_[/*timeIdx=*/1] = this->maxWaterSaturation_[/*timeIdx=*/0];
 
-                Scalar So = decay<Scalar>(fs.saturation(oilPhaseIdx));
+        forEachElementIntensiveQuantities_([&](unsigned compressedDofIdx, const IntensiveQuantities& iq)
+        {
+            const auto& fs = iq.fluidState();
 
-                this->maxOilSaturation_[compressedDofIdx] = std::max(this->maxOilSaturation_[compressedDofIdx], So);
+            if (updateMaxWaterSaturation) {
+                Scalar Sw = decay<Scalar>(fs.saturation(waterPhaseIdx));
+                this->maxWaterSaturation_[compressedDofIdx] = std::max(this->maxWaterSaturation_[compressedDofIdx], Sw);
             }
 
-            // we need to invalidate the intensive quantities cache here because the
-            // derivatives of Rs and Rv will most likely have changed
-            return true;
-        }
+            if (updateMinPressure)
+                this->minOilPressure_[compressedDofIdx] =
+                    std::min(this->minOilPressure_[compressedDofIdx],
+                             getValue(fs.pressure(oilPhaseIdx)));
 
-        return false;
-    }
-
-    bool updateMaxWaterSaturation_()
-    {
-        // water compaction is activated in ROCKCOMP
-        if (this->maxWaterSaturation_.empty())
-            return false;
+            if (updateHysteresis)
+                materialLawManager_->updateHysteresis(fs, compressedDofIdx);
 
-        this->maxWaterSaturation_[/*timeIdx=*/1] = this->maxWaterSaturation_[/*timeIdx=*/0];
-        ElementContext elemCtx(this->simulator());
-        const auto& vanguard = this->simulator().vanguard();
-        auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-        const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const Element& elem = *elemIt;
-
-            elemCtx.updatePrimaryStencil(elem);
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-
-            unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto& iq = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto& fs = iq.fluidState();
-
-            Scalar Sw = decay<Scalar>(fs.saturation(waterPhaseIdx));
-            this->maxWaterSaturation_[compressedDofIdx] = std::max(this->maxWaterSaturation_[compressedDofIdx], Sw);
-        }
+            if (updateMaxOilSaturation) {
+                Scalar So = decay<Scalar>(fs.saturation(oilPhaseIdx));
+                this->maxOilSaturation_[compressedDofIdx] = std::max(this->maxOilSaturation_[compressedDofIdx], So);
+            }
+        });
 
+        // the derivatives of Rs and Rv will most likely have changed if VAPPARS is
+        // used, and the other quantities are inputs of the intensive quantities
         return true;
     }
 
-    bool updateMinPressure_()
+    // call func(compressedDofIdx, intQuants) for all elements including the ones in
+    // the ghost and overlap regions. The intensive quantities are taken directly from
+    // the cache of the model and are only computed for elements which are not cached.
+    // This only avoids recomputing them, the intensive quantity update itself still
+    // evaluates the PVT and saturation functions cell by cell. The elements are processed concurrently, func must thus only write to the
+    // entries of compressedDofIdx. Then the result does not depend on the number of
+    // threads either.
+    template <class Func>
+    void forEachElementIntensiveQuantities_(Func func) const
     {
-        // IRREVERS option is used in ROCKCOMP
-        if (this->minOilPressure_.empty())
-            return false;
-
-        ElementContext elemCtx(this->simulator());
-        const auto& vanguard = this->simulator().vanguard();
-        auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-        const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const Element& elem = *elemIt;
-
-            elemCtx.updatePrimaryStencil(elem);
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+        const auto& simulator = this->simulator();
+        const auto& model = this->model();
+        const auto& elementMapper = model.elementMapper();
+
+        if (sweepElements_.empty()) {
+            const auto& gridView = simulator.vanguard().gridView();
+            auto elemIt = gridView.template begin</*codim=*/0>();
+            const auto& elemEndIt = gridView.template end</*codim=*/0>();
+            for (; elemIt != elemEndIt; ++elemIt)
+                sweepElements_.push_back(*elemIt);
+            sweepElementCtx_.resize(ThreadManager::maxThreads());
+        }
 
-            unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto& iq = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto& fs = iq.fluidState();
+        const int numElements = sweepElements_.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+        for (int elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+            const Element& elem = sweepElements_[elemIdx];
+            unsigned compressedDofIdx = elementMapper.index(elem);
+
+            const auto* iq = model.cachedIntensiveQuantities(compressedDofIdx, /*timeIdx=*/0);
+            if (!iq) {
+                auto& elemCtx = sweepElementCtx_[ThreadManager::threadId()];
+                if (!elemCtx)
+                    elemCtx = std::make_unique<ElementContext>(simulator);
+                elemCtx->updatePrimaryStencil(elem);
+                elemCtx->updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+                iq = &elemCtx->intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
+            }
 
-            this->minOilPressure_[compressedDofIdx] =
-                std::min(this->minOilPressure_[compressedDofIdx],
-                         getValue(fs.pressure(oilPhaseIdx)));
+            func(compressedDofIdx, *iq);
         }
-
-        return true;
     }
 
     void readMaterialParameters_()
@@ -2599,52 +2702,14 @@ private:
         }
     }
 
-    // update the hysteresis parameters of the material laws for the whole grid
-    bool updateHysteresis_()
-    {
-        if (!materialLawManager_->enableHysteresis())
-            return false;
-
-        // we need to update the hysteresis data for _all_ elements (i.e., not just the
-        // interior ones) to avoid desynchronization of the processes in the parallel case!
-        const auto& simulator = this->simulator();
-        ElementContext elemCtx(simulator);
-        const auto& vanguard = simulator.vanguard();
-        auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-        const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const Element& elem = *elemIt;
-
-            elemCtx.updatePrimaryStencil(elem);
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-
-            unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto& intQuants = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-            materialLawManager_->updateHysteresis(intQuants.fluidState(), compressedDofIdx);
-        }
-        return true;
-    }
-
     void updateMaxPolymerAdsorption_()
     {
         // we need to update the max polymer adsoption data for all elements
-        const auto& simulator = this->simulator();
-        ElementContext elemCtx(simulator);
-        const auto& vanguard = simulator.vanguard();
-        auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-        const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const Element& elem = *elemIt;
-
-            elemCtx.updatePrimaryStencil(elem);
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-
-            unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto& intQuants = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-
+        forEachElementIntensiveQuantities_([this](unsigned compressedDofIdx, const IntensiveQuantities& intQuants)
+        {
             this->maxPolymerAdsorption_[compressedDofIdx] = std::max(this->maxPolymerAdsorption_[compressedDofIdx],
                                                                      scalarValue(intQuants.polymerAdsorption()));
-        }
+        });
     }
 
     struct PffDofData_
@@ -2653,6 +2718,8 @@ private:
         ConditionalStorage<enableEnergy, Scalar> thermalHalfTransOut;
         ConditionalStorage<enableDiffusion, Scalar> diffusivity;
         Scalar transmissibility;
+        Scalar thresholdPressure;
+        Scalar dZg; // (depth(center) - depth(neighbor)) * gravity
     };
 
     // update the prefetch friendly data object
@@ -2670,6 +2737,13 @@ private:
             if (localDofIdx != 0) {
                 unsigned globalCenterElemIdx = elementMapper.index(stencil.entity(/*dofIdx=*/0));
                 dofData.transmissibility = transmissibilities_.transmissibility(globalCenterElemIdx, globalElemIdx);
+                dofData.thresholdPressure = thresholdPressuresInitialized_
+                    ? thresholdPressures_.thresholdPressure(globalCenterElemIdx, globalElemIdx)
+                    : 0.0;
+
+                const auto& vanguard = this->simulator().vanguard();
+                dofData.dZg = (vanguard.cellCenterDepth(globalCenterElemIdx) - vanguard.cellCenterDepth(globalElemIdx))
+                    * this->gravity_[dim - 1];
 
                 if constexpr (enableEnergy) {
                     *dofData.thermalHalfTransIn = transmissibilities_.thermalHalfTrans(globalCenterElemIdx, globalElemIdx);
@@ -2871,6 +2945,8 @@ private:
     std::shared_ptr<EclThermalLawManager> thermalLawManager_;
 
     EclThresholdPressure<TypeTag> thresholdPressures_;
+    // the threshold pressures are only available after initialSolutionApplied()
+    bool thresholdPressuresInitialized_ = false;
 
     std::vector<InitialFluidState> initialFluidStates_;
 
@@ -2887,6 +2963,10 @@ private:
     std::unique_ptr<EclWriterType> eclWriter_;
 
     PffGridVector<GridView, Stencil, PffDofData_, DofMapper> pffDofData_;
+
+    // all elements and one context per thread for forEachElementIntensiveQuantities_()
+    mutable std::vector<Element> sweepElements_;
+    mutable std::vector<std::unique_ptr<ElementContext>> sweepElementCtx_;
     TracerModel tracerModel_;
 
     std::vector<bool> freebcX_;
@@ -32,6 +32,8 @@
 
 #include <opm/models/utils/propertysystem.hh>
 
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -151,6 +153,33 @@ public:
     void deserialize(Restarter&)
     { /* not implemented */ }
 
+    /*!
+     * \brief Checkpointing of the tracer concentrations and well tracer rates.
+     */
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        std::vector<Scalar> values;
+        for (auto& concentration : this->tracerConcentration_) {
+            if (serializer.isSerializing())
+                values.assign(concentration.begin(), concentration.end());
+            serializer(values);
+            if (!serializer.isSerializing()) {
+                if (values.size() != concentration.size())
+                    throw std::runtime_error("Tracer concentrations do not match the grid");
+                std::copy(values.begin(), values.end(), concentration.begin());
+            }
+        }
+        serializer(this->wellTracerRate_);
+
+        if (!serializer.isSerializing()) {
+            for (auto* tr : {&wat_, &oil_, &gas_}) {
+                for (int tIdx = 0; tIdx < tr->numTracer(); ++tIdx)
+                    tr->concentration_[tIdx] = this->tracerConcentration_[tr->idx_[tIdx]];
+            }
+        }
+    }
+
 protected:
 
     // evaluate water storage volume(s) in a single cell
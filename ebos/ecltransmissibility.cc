@@ -47,39 +47,10 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
 
-namespace {
-
-constexpr unsigned elemIdxShift = 32; // bits
-
-std::uint64_t isId(std::uint32_t elemIdx1, std::uint32_t elemIdx2)
-{
-    std::uint32_t elemAIdx = std::min(elemIdx1, elemIdx2);
-    std::uint64_t elemBIdx = std::max(elemIdx1, elemIdx2);
-
-    return (elemBIdx<<elemIdxShift) + elemAIdx;
-}
-
-std::pair<std::uint32_t, std::uint32_t> isIdReverse(const std::uint64_t& id)
-{
-    // Assigning an unsigned integer to a narrower type discards the most significant bits.
-    // See "The C programming language", section A.6.2.
-    // NOTE that the ordering of element A and B may have changed
-    std::uint32_t elemAIdx = id;
-    std::uint32_t elemBIdx = (id - elemAIdx) >> elemIdxShift;
-
-    return std::make_pair(elemAIdx, elemBIdx);
-}
-
-std::uint64_t directionalIsId(std::uint32_t elemIdx1, std::uint32_t elemIdx2)
-{
-    return (std::uint64_t(elemIdx1)<<elemIdxShift) + elemIdx2;
-}
-
-}
-
 namespace Opm {
 
 template<class Grid, class GridView, class ElementMapper, class Scalar>
@@ -107,7 +78,12 @@ template<class Grid, class GridView, class ElementMapper, class Scalar>
 Scalar EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
 transmissibility(unsigned elemIdx1, unsigned elemIdx2) const
 {
-    return trans_.at(isId(elemIdx1, elemIdx2));
+    const int faceIdx = faceIndex(elemIdx1, elemIdx2);
+    if (faceIdx < 0)
+        throw std::out_of_range(fmt::format("No face between elements {} and {}",
+                                            elemIdx1, elemIdx2));
+
+    return trans_[faceIdx];
 }
 
 template<class Grid, class GridView, class ElementMapper, class Scalar>
@@ -121,7 +97,12 @@ template<class Grid, class GridView, class ElementMapper, class Scalar>
 Scalar EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
 thermalHalfTrans(unsigned insideElemIdx, unsigned outsideElemIdx) const
 {
-    return thermalHalfTrans_.at(directionalIsId(insideElemIdx, outsideElemIdx));
+    const int entry = neighbourEntry_(insideElemIdx, outsideElemIdx);
+    if (entry < 0 || thermalHalfTrans_.empty())
+        throw std::out_of_range(fmt::format("No thermal half transmissibility between elements {} and {}",
+                                            insideElemIdx, outsideElemIdx));
+
+    return thermalHalfTrans_[entry];
 }
 
 template<class Grid, class GridView, class ElementMapper, class Scalar>
@@ -138,13 +119,154 @@ diffusivity(unsigned elemIdx1, unsigned elemIdx2) const
     if (diffusivity_.empty())
         return 0.0;
 
-    return diffusivity_.at(isId(elemIdx1, elemIdx2));
+    const int faceIdx = faceIndex(elemIdx1, elemIdx2);
+    if (faceIdx < 0)
+        throw std::out_of_range(fmt::format("No face between elements {} and {}",
+                                            elemIdx1, elemIdx2));
+
+    return diffusivity_[faceIdx];
+}
+
+template<class Grid, class GridView, class ElementMapper, class Scalar>
+int EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
+faceIndex(unsigned elemIdx1, unsigned elemIdx2) const
+{
+    const int entry = neighbourEntry_(elemIdx1, elemIdx2);
+    return entry < 0 ? -1 : static_cast<int>(neighbourFace_[entry]);
+}
+
+template<class Grid, class GridView, class ElementMapper, class Scalar>
+int EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
+neighbourEntry_(unsigned elemIdx1, unsigned elemIdx2) const
+{
+    if (elemIdx1 + 1 >= neighbourOffsets_.size())
+        return -1;
+
+    // the neighbour lists are short (six entries for a Cartesian grid) and sorted
+    const auto begin = neighbours_.begin() + neighbourOffsets_[elemIdx1];
+    const auto end = neighbours_.begin() + neighbourOffsets_[elemIdx1 + 1];
+    const auto it = std::lower_bound(begin, end, elemIdx2);
+    if (it == end || *it != elemIdx2)
+        return -1;
+
+    return static_cast<int>(it - neighbours_.begin());
+}
+
+template<class Grid, class GridView, class ElementMapper, class Scalar>
+void EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
+buildFaceTable_(const ElementMapper& elemMapper)
+{
+    const unsigned numElements = elemMapper.size();
+    const auto& elemEndIt = gridView_.template end</*codim=*/ 0>();
+
+    // count the intersections of each element which have a neighbour ...
+    neighbourOffsets_.assign(numElements + 1, 0);
+    auto elemIt = gridView_.template begin</*codim=*/ 0>();
+    for (; elemIt != elemEndIt; ++elemIt) {
+        const auto& elem = *elemIt;
+        unsigned elemIdx = elemMapper.index(elem);
+        auto isIt = gridView_.ibegin(elem);
+        const auto& isEndIt = gridView_.iend(elem);
+        for (; isIt != isEndIt; ++ isIt)
+            if (isIt->neighbor())
+                ++neighbourOffsets_[elemIdx + 1];
+    }
+    std::partial_sum(neighbourOffsets_.begin(), neighbourOffsets_.end(), neighbourOffsets_.begin());
+
+    // ... then fill in the neighbours ...
+    neighbours_.resize(neighbourOffsets_.back());
+    std::vector<unsigned> nextEntry(neighbourOffsets_.begin(), neighbourOffsets_.end() - 1);
+    elemIt = gridView_.template begin</*codim=*/ 0>();
+    for (; elemIt != elemEndIt; ++elemIt) {
+        const auto& elem = *elemIt;
+        unsigned elemIdx = elemMapper.index(elem);
+        auto isIt = gridView_.ibegin(elem);
+        const auto& isEndIt = gridView_.iend(elem);
+        for (; isIt != isEndIt; ++ isIt)
+            if (isIt->neighbor())
+                neighbours_[nextEntry[elemIdx]++] = elemMapper.index(isIt->outside());
+    }
+
+    // ... and sort them, merging several intersections between the same two
+    // elements into a single face
+    unsigned numEntries = 0;
+    for (unsigned elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+        auto begin = neighbours_.begin() + neighbourOffsets_[elemIdx];
+        auto end = neighbours_.begin() + neighbourOffsets_[elemIdx + 1];
+        std::sort(begin, end);
+        end = std::unique(begin, end);
+        neighbourOffsets_[elemIdx] = numEntries;
+        if (neighbours_.begin() + numEntries != begin)
+            std::copy(begin, end, neighbours_.begin() + numEntries);
+        numEntries += end - begin;
+    }
+    neighbourOffsets_[numElements] = numEntries;
+    neighbours_.resize(numEntries);
+    neighbours_.shrink_to_fit();
+
+    // number the faces such that both directions of a connection share one index
+    neighbourFace_.resize(numEntries);
+    unsigned numFaces = 0;
+    for (unsigned elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+        for (unsigned entry = neighbourOffsets_[elemIdx]; entry < neighbourOffsets_[elemIdx + 1]; ++entry) {
+            const unsigned neighbourIdx = neighbours_[entry];
+            const int reverseEntry = neighbourIdx < elemIdx ? neighbourEntry_(neighbourIdx, elemIdx) : -1;
+            neighbourFace_[entry] = reverseEntry < 0 ? numFaces++ : neighbourFace_[reverseEntry];
+        }
+    }
+    trans_.assign(numFaces, 0.0);
+}
+
+template<class Grid, class GridView, class ElementMapper, class Scalar>
+std::vector<double> EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
+faceMultipliers() const
+{
+    static constexpr std::array<FaceDir::DirEnum, 6> faceDirs {
+        FaceDir::XMinus, FaceDir::XPlus,
+        FaceDir::YMinus, FaceDir::YPlus,
+        FaceDir::ZMinus, FaceDir::ZPlus
+    };
+
+    const auto& transMult = eclState_.getTransMult();
+    const unsigned numElements = gridView_.size(/*codim=*/0);
+    std::vector<double> multipliers(numElements * faceDirs.size());
+    for (unsigned elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+        const unsigned cartElemIdx = cartMapper_.cartesianIndex(elemIdx);
+        for (unsigned dirIdx = 0; dirIdx < faceDirs.size(); ++dirIdx)
+            multipliers[elemIdx * faceDirs.size() + dirIdx] =
+                transMult.getMultiplier(cartElemIdx, faceDirs[dirIdx]);
+    }
+
+    return multipliers;
+}
+
+template<class Grid, class GridView, class ElementMapper, class Scalar>
+void EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
+updateModifiedMultipliers(const std::vector<double>& oldMultipliers)
+{
+    const std::vector<double> newMultipliers = faceMultipliers();
+    if (oldMultipliers.size() != newMultipliers.size() || neighbourOffsets_.empty()) {
+        update_(/*global=*/true, nullptr);
+        return;
+    }
 
+    const unsigned numElements = gridView_.size(/*codim=*/0);
+    const unsigned numDirs = newMultipliers.size() / std::max(numElements, 1u);
+    std::vector<bool> modifiedElements(numElements, false);
+    for (unsigned elemIdx = 0; elemIdx < numElements; ++elemIdx)
+        modifiedElements[elemIdx] =
+            !std::equal(newMultipliers.begin() + elemIdx * numDirs,
+                        newMultipliers.begin() + (elemIdx + 1) * numDirs,
+                        oldMultipliers.begin() + elemIdx * numDirs);
+
+    // this is called on all processes, even if none of the local elements
+    // are affected, as update_() may need to communicate
+    update_(/*global=*/true, &modifiedElements);
 }
 
 template<class Grid, class GridView, class ElementMapper, class Scalar>
 void EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
-update(bool global)
+update_(bool global, const std::vector<bool>* modifiedElements)
 {
     const auto& cartDims = cartMapper_.cartesianDimensions();
     auto& transMult = eclState_.getTransMult();
@@ -156,7 +278,45 @@ update(bool global)
     const bool updateDiffusivity = eclState_.getSimulationConfig().isDiffusive() && enableDiffusivity_;
     unsigned numElements = elemMapper.size();
 
-    extractPermeability_();
+    // The MULTZ needs special case if the option is ALL
+    // Then the smallest multiplier is applied.
+    // Default is to apply the top and bottom multiplier
+    bool useSmallestMultiplier;
+    if (comm.rank() == 0) {
+        const auto& eclGrid = eclState_.getInputGrid();
+        useSmallestMultiplier = eclGrid.getMultzOption() == PinchMode::ModeEnum::ALL;
+    }
+    if (global && comm.size() > 1) {
+        comm.broadcast(&useSmallestMultiplier, 1, 0);
+    }
+
+    // Only the faces of the modified elements are recomputed if a set of
+    // elements is given. This is not possible if the multipliers of a face
+    // depend on other elements (MULTZ option ALL) or if the results are
+    // edited by TRAN{XYZ}, in which case everything is recomputed.
+    const bool incremental = modifiedElements != nullptr
+        && !useSmallestMultiplier
+        && !tranActive_(global)
+        && (!updateDiffusivity || diffusivity_.size() == trans_.size());
+    auto isModified = [incremental, modifiedElements](unsigned elemIdx)
+    { return !incremental || (*modifiedElements)[elemIdx]; };
+
+    // the permeabilities are not affected by the multipliers
+    if (!incremental)
+        extractPermeability_();
+
+    // in the incremental case, the modified elements and their neighbours
+    // need their centroids
+    std::vector<bool> needsCentroid;
+    if (incremental) {
+        needsCentroid = *modifiedElements;
+        for (unsigned elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+            if (!(*modifiedElements)[elemIdx])
+                continue;
+            for (unsigned entry = neighbourOffsets_[elemIdx]; entry < neighbourOffsets_[elemIdx + 1]; ++entry)
+                needsCentroid[neighbours_[entry]] = true;
+        }
+    }
 
     // calculate the axis specific centroids of all elements
     std::array<std::vector<DimVector>, dimWorld> axisCentroids;
@@ -170,6 +330,8 @@ update(bool global)
     for (; elemIt != elemEndIt; ++elemIt, ++centroidIdx) {
         const auto& elem = *elemIt;
         unsigned elemIdx = elemMapper.index(elem);
+        if (incremental && !needsCentroid[elemIdx])
+            continue;
 
         // compute the axis specific "centroids" used for the transmissibilities. for
         // consistency with the flow simulator, we use the element centers as
@@ -189,40 +351,34 @@ update(bool global)
                 axisCentroids[axisIdx][elemIdx][dimIdx] = centroid[dimIdx];
     }
 
-    // reserving some space in the hashmap upfront saves quite a bit of time because
-    // resizes are costly for hashmaps and there would be quite a few of them if we
-    // would not have a rough idea of how large the final map will be (the rough idea
-    // is a conforming Cartesian grid).
-    trans_.clear();
-    trans_.reserve(numElements*3*1.05);
+    // the connectivity of the grid does not change, so the face table only
+    // needs to be set up once
+    if (neighbourOffsets_.empty())
+        buildFaceTable_(elemMapper);
 
-    transBoundary_.clear();
+    // the faces which get recomputed, the NNCs are only reapplied to these
+    std::vector<bool> updatedFaces;
+    if (incremental)
+        updatedFaces.resize(trans_.size(), false);
 
-    // if energy is enabled, let's do the same for the "thermal half transmissibilities"
-    if (enableEnergy_) {
-        thermalHalfTrans_.clear();
-        thermalHalfTrans_.reserve(numElements*6*1.05);
+    if (!incremental) {
+        std::fill(trans_.begin(), trans_.end(), 0.0);
 
-        thermalHalfTransBoundary_.clear();
-    }
+        transBoundary_.clear();
 
-    // if diffusion is enabled, let's do the same for the "diffusivity"
-    if (updateDiffusivity) {
-        diffusivity_.clear();
-        diffusivity_.reserve(numElements*3*1.05);
-        extractPorosity_();
-    }
+        // if energy is enabled, the "thermal half transmissibilities" are stored
+        // for both directions of each face
+        if (enableEnergy_) {
+            thermalHalfTrans_.assign(neighbours_.size(), 0.0);
 
-    // The MULTZ needs special case if the option is ALL
-    // Then the smallest multiplier is applied.
-    // Default is to apply the top and bottom multiplier
-    bool useSmallestMultiplier;
-    if (comm.rank() == 0) {
-        const auto& eclGrid = eclState_.getInputGrid();
-        useSmallestMultiplier = eclGrid.getMultzOption() == PinchMode::ModeEnum::ALL;
-    }
-    if (global && comm.size() > 1) {
-        comm.broadcast(&useSmallestMultiplier, 1, 0);
+            thermalHalfTransBoundary_.clear();
+        }
+
+        // if diffusion is enabled, let's do the same for the "diffusivity"
+        if (updateDiffusivity) {
+            diffusivity_.assign(trans_.size(), 0.0);
+            extractPorosity_();
+        }
     }
 
     // compute the transmissibilities for all intersections
@@ -240,6 +396,11 @@ update(bool global)
 
             // deal with grid boundaries
             if (intersection.boundary()) {
+                if (!isModified(elemIdx)) {
+                    ++ boundaryIsIdx;
+                    continue;
+                }
+
                 // compute the transmissibilty for the boundary intersection
                 const auto& geometry = intersection.geometry();
                 const auto& faceCenterInside = geometry.center();
@@ -299,6 +460,13 @@ update(bool global)
             if (insideCartElemIdx > outsideCartElemIdx)
                 continue;
 
+            if (!isModified(elemIdx) && !isModified(outsideElemIdx))
+                continue;
+
+            const unsigned faceIdx = faceIndex(elemIdx, outsideElemIdx);
+            if (incremental)
+                updatedFaces[faceIdx] = true;
+
             // local indices of the faces of the inside and
             // outside elements which contain the intersection
             int insideFaceIdx  = intersection.indexInInside();
@@ -308,7 +476,7 @@ update(bool global)
                 // NNC. Set zero transmissibility, as it will be
                 // *added to* by applyNncToGridTrans_() later.
                 assert(outsideFaceIdx == -1);
-                trans_[isId(elemIdx, outsideElemIdx)] = 0.0;
+                trans_[faceIdx] = 0.0;
                 continue;
             }
 
@@ -403,7 +571,7 @@ update(bool global)
                                                    outsideCartElemIdx,
                                                    faceDir);
 
-            trans_[isId(elemIdx, outsideElemIdx)] = trans;
+            trans_[faceIdx] = trans;
 
             // update the "thermal half transmissibility" for the intersection
             if (enableEnergy_) {
@@ -426,8 +594,10 @@ update(bool global)
                                                         axisCentroids),
                                         1.0);
                 //TODO Add support for multipliers
-                thermalHalfTrans_[directionalIsId(elemIdx, outsideElemIdx)] = halfDiffusivity1;
-                thermalHalfTrans_[directionalIsId(outsideElemIdx, elemIdx)] = halfDiffusivity2;
+                thermalHalfTrans_[neighbourEntry_(elemIdx, outsideElemIdx)] = halfDiffusivity1;
+                const int reverseEntry = neighbourEntry_(outsideElemIdx, elemIdx);
+                if (reverseEntry >= 0)
+                    thermalHalfTrans_[reverseEntry] = halfDiffusivity2;
            }
 
             // update the "diffusive half transmissibility" for the intersection
@@ -463,13 +633,14 @@ update(bool global)
                     diffusivity = 1.0 / (1.0/halfDiffusivity1 + 1.0/halfDiffusivity2);
 
 
-                diffusivity_[isId(elemIdx, outsideElemIdx)] = diffusivity;
+                diffusivity_[faceIdx] = diffusivity;
            }
         }
     }
 
     // potentially overwrite and/or modify  transmissibilities based on input from deck
-    updateFromEclState_(global);
+    if (!incremental)
+        updateFromEclState_(global);
 
     // Create mapping from global to local index
     const size_t cartesianSize = cartMapper_.cartesianSize();
@@ -484,8 +655,8 @@ update(bool global)
         int cartElemIdx = cartMapper_.cartesianIndex(elemIdx);
         globalToLocal[cartElemIdx] = elemIdx;
     }
-    applyEditNncToGridTrans_(globalToLocal);
-    applyNncToGridTrans_(globalToLocal);
+    applyEditNncToGridTrans_(globalToLocal, updatedFaces);
+    applyNncToGridTrans_(globalToLocal, updatedFaces);
 
     //remove very small non-neighbouring transmissibilities
     removeSmallNonCartesianTransmissibilities_();
@@ -555,19 +726,23 @@ void EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
 removeSmallNonCartesianTransmissibilities_()
 {
     const auto& cartDims = cartMapper_.cartesianDimensions();
-    for (auto&& trans: trans_) {
-        if (trans.second < transmissibilityThreshold_) {
-            const auto& id = trans.first;
-            const auto& elements = isIdReverse(id);
-            int gc1 = std::min(cartMapper_.cartesianIndex(elements.first), cartMapper_.cartesianIndex(elements.second));
-            int gc2 = std::max(cartMapper_.cartesianIndex(elements.first), cartMapper_.cartesianIndex(elements.second));
+    const unsigned numElements = neighbourOffsets_.size() - 1;
+    for (unsigned elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+        for (unsigned entry = neighbourOffsets_[elemIdx]; entry < neighbourOffsets_[elemIdx + 1]; ++entry) {
+            const unsigned neighbourIdx = neighbours_[entry];
+            auto& trans = trans_[neighbourFace_[entry]];
+            if (neighbourIdx < elemIdx || trans >= transmissibilityThreshold_)
+                continue;
+
+            int gc1 = std::min(cartMapper_.cartesianIndex(elemIdx), cartMapper_.cartesianIndex(neighbourIdx));
+            int gc2 = std::max(cartMapper_.cartesianIndex(elemIdx), cartMapper_.cartesianIndex(neighbourIdx));
 
             // only adjust the NNCs
             if (gc2 - gc1 == 1 || gc2 - gc1 == cartDims[0] || gc2 - gc1 == cartDims[0]*cartDims[1])
                 continue;
 
             //remove transmissibilities less than the threshold (by default 1e-6 in the deck's unit system)
-            trans.second = 0.0;
+            trans = 0.0;
         }
     }
 }
@@ -611,6 +786,17 @@ applyAllZMultipliers_(Scalar& trans,
     }
 }
 
+template<class Grid, class GridView, class ElementMapper, class Scalar>
+bool EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
+tranActive_(bool global) const
+{
+    const FieldPropsManager* fp =
+        (global) ? &(eclState_.fieldProps()) :
+        &(eclState_.globalFieldProps());
+
+    return fp->tran_active("TRANX") || fp->tran_active("TRANY") || fp->tran_active("TRANZ");
+}
+
 template<class Grid, class GridView, class ElementMapper, class Scalar>
 void EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
 updateFromEclState_(bool global)
@@ -649,7 +835,6 @@ EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
 createTransmissibilityArrays_(const std::array<bool,3>& is_tran)
 {
     const auto& cartDims = cartMapper_.cartesianDimensions();
-    ElementMapper elemMapper(gridView_, Dune::mcmgElementLayout());
 
     auto numElem = gridView_.size(/*codim=*/0);
     std::array<std::vector<double>,3> trans =
@@ -657,51 +842,35 @@ createTransmissibilityArrays_(const std::array<bool,3>& is_tran)
           std::vector<double>(is_tran[1] ? numElem : 0, 0),
           std::vector<double>(is_tran[2] ? numElem : 0, 0)};
 
-    // compute the transmissibilities for all intersections
-    auto elemIt = gridView_.template begin</*codim=*/ 0>();
-    const auto& elemEndIt = gridView_.template end</*codim=*/ 0>();
-
-    for (; elemIt != elemEndIt; ++elemIt) {
-        const auto& elem = *elemIt;
-        auto isIt = gridView_.ibegin(elem);
-        const auto& isEndIt = gridView_.iend(elem);
-        for (; isIt != isEndIt; ++ isIt) {
-            // store intersection, this might be costly
-            const auto& intersection = *isIt;
-            if (!intersection.neighbor())
-                continue; // intersection is on the domain boundary
-
+    // walk all connections of the face table
+    for (unsigned c1 = 0; c1 < neighbourOffsets_.size() - 1; ++c1) {
+        const int gc1 = cartMapper_.cartesianIndex(c1);
+        for (unsigned entry = neighbourOffsets_[c1]; entry < neighbourOffsets_[c1 + 1]; ++entry) {
             // In the EclState TRANX[c1] is transmissibility in X+
-            // direction. Ordering of compressed (c1,c2) and cartesian index
-            // (gc1, gc2) is coherent (c1 < c2 <=> gc1 < gc2). This also
-            // holds for the global grid. While distributing changes the
-            // order of the local indices, the transmissibilities are still
-            // stored at the cell with the lower global cartesian index as
-            // the fieldprops are communicated by the grid.
-            unsigned c1 = elemMapper.index(intersection.inside());
-            unsigned c2 = elemMapper.index(intersection.outside());
-            int gc1 = cartMapper_.cartesianIndex(c1);
-            int gc2 = cartMapper_.cartesianIndex(c2);
-
+            // direction. While distributing changes the order of the
+            // local indices, the transmissibilities are still stored at
+            // the cell with the lower global cartesian index as the
+            // fieldprops are communicated by the grid.
+            const int gc2 = cartMapper_.cartesianIndex(neighbours_[entry]);
             if (gc1 > gc2)
                 continue; // we only need to handle each connection once, thank you.
 
-            auto isID = isId(c1, c2);
+            const Scalar faceTrans = trans_[neighbourFace_[entry]];
 
             if (gc2 - gc1 == 1 && cartDims[0] > 1) {
                 if (is_tran[0])
                     // set simulator internal transmissibilities to values from inputTranx
-                     trans[0][c1] = trans_[isID];
+                     trans[0][c1] = faceTrans;
             }
             else if (gc2 - gc1 == cartDims[0] && cartDims[1] > 1) {
                 if (is_tran[1])
                     // set simulator internal transmissibilities to values from inputTrany
-                     trans[1][c1] = trans_[isID];
+                     trans[1][c1] = faceTrans;
             }
             else if (gc2 - gc1 == cartDims[0]*cartDims[1]) {
                 if (is_tran[2])
                     // set simulator internal transmissibilities to values from inputTranz
-                     trans[2][c1] = trans_[isID];
+                     trans[2][c1] = faceTrans;
             }
             //else.. We don't support modification of NNC at the moment.
         }
@@ -716,52 +885,32 @@ resetTransmissibilityFromArrays_(const std::array<bool,3>& is_tran,
                                  const std::array<std::vector<double>,3>& trans)
 {
     const auto& cartDims = cartMapper_.cartesianDimensions();
-    ElementMapper elemMapper(gridView_, Dune::mcmgElementLayout());
-
-    // compute the transmissibilities for all intersections
-    auto elemIt = gridView_.template begin</*codim=*/ 0>();
-    const auto& elemEndIt = gridView_.template end</*codim=*/ 0>();
-
-    for (; elemIt != elemEndIt; ++elemIt) {
-        const auto& elem = *elemIt;
-        auto isIt = gridView_.ibegin(elem);
-        const auto& isEndIt = gridView_.iend(elem);
-        for (; isIt != isEndIt; ++ isIt) {
-            // store intersection, this might be costly
-            const auto& intersection = *isIt;
-            if (!intersection.neighbor())
-                continue; // intersection is on the domain boundary
 
-            // In the EclState TRANX[c1] is transmissibility in X+
-            // direction. Ordering of compressed (c1,c2) and cartesian index
-            // (gc1, gc2) is coherent (c1 < c2 <=> gc1 < gc2). This also
-            // holds for the global grid. While distributing changes the
-            // order of the local indices, the transmissibilities are still
-            // stored at the cell with the lower global cartesian index as
-            // the fieldprops are communicated by the grid.
-            unsigned c1 = elemMapper.index(intersection.inside());
-            unsigned c2 = elemMapper.index(intersection.outside());
-            int gc1 = cartMapper_.cartesianIndex(c1);
-            int gc2 = cartMapper_.cartesianIndex(c2);
+    // walk all connections of the face table
+    for (unsigned c1 = 0; c1 < neighbourOffsets_.size() - 1; ++c1) {
+        const int gc1 = cartMapper_.cartesianIndex(c1);
+        for (unsigned entry = neighbourOffsets_[c1]; entry < neighbourOffsets_[c1 + 1]; ++entry) {
+            // See createTransmissibilityArrays_() for the layout of TRAN{XYZ}.
+            const int gc2 = cartMapper_.cartesianIndex(neighbours_[entry]);
             if (gc1 > gc2)
                 continue; // we only need to handle each connection once, thank you.
 
-            auto isID = isId(c1, c2);
+            Scalar& faceTrans = trans_[neighbourFace_[entry]];
 
             if (gc2 - gc1 == 1 && cartDims[0] > 1) {
                 if (is_tran[0])
                     // set simulator internal transmissibilities to values from inputTranx
-                    trans_[isID] = trans[0][c1];
+                    faceTrans = trans[0][c1];
             }
             else if (gc2 - gc1 == cartDims[0] && cartDims[1] > 1) {
                 if (is_tran[1])
                     // set simulator internal transmissibilities to values from inputTrany
-                    trans_[isID] = trans[1][c1];
+                    faceTrans = trans[1][c1];
             }
             else if (gc2 - gc1 == cartDims[0]*cartDims[1]) {
                 if (is_tran[2])
                     // set simulator internal transmissibilities to values from inputTranz
-                    trans_[isID] = trans[2][c1];
+                    faceTrans = trans[2][c1];
             }
             //else.. We don't support modification of NNC at the moment.
         }
@@ -813,7 +962,8 @@ computeFaceProperties(const Intersection& intersection,
 template<class Grid, class GridView, class ElementMapper, class Scalar>
 std::tuple<std::vector<NNCdata>, std::vector<NNCdata>>
 EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
-applyNncToGridTrans_(const std::vector<int>& cartesianToCompressed)
+applyNncToGridTrans_(const std::vector<int>& cartesianToCompressed,
+                     const std::vector<bool>& updatedFaces)
 {
     // First scale NNCs with EDITNNC.
     std::vector<NNCdata> unprocessedNnc;
@@ -844,17 +994,21 @@ applyNncToGridTrans_(const std::vector<int>& cartesianToCompressed)
             continue;
         }
 
-        auto candidate = trans_.find(isId(low, high));
+        const int faceIdx = faceIndex(low, high);
 
-        if (candidate == trans_.end())
+        if (faceIdx < 0)
             // This NNC is not resembled by the grid. Save it for later
             // processing with local cell values
             unprocessedNnc.push_back(nncEntry);
+        else if (!updatedFaces.empty() && !updatedFaces[faceIdx])
+            // the transmissibility of the face was not recomputed and
+            // still contains the NNC
+            continue;
         else {
             // NNC is represented by the grid and might be a neighboring connection
             // In this case the transmissibilty is added to the value already
             // set or computed.
-            candidate->second += nncEntry.trans;
+            trans_[faceIdx] += nncEntry.trans;
             processedNnc.push_back(nncEntry);
         }
     }
@@ -863,7 +1017,8 @@ applyNncToGridTrans_(const std::vector<int>& cartesianToCompressed)
 
 template<class Grid, class GridView, class ElementMapper, class Scalar>
 void EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
-applyEditNncToGridTrans_(const std::vector<int>& globalToLocal)
+applyEditNncToGridTrans_(const std::vector<int>& globalToLocal,
+                         const std::vector<bool>& updatedFaces)
 {
     const auto& nnc_input = eclState_.getInputNNC();
     const auto& editNnc = nnc_input.edit();
@@ -900,8 +1055,8 @@ applyEditNncToGridTrans_(const std::vector<int>& globalToLocal)
         if (low > high)
             std::swap(low, high);
 
-        auto candidate = trans_.find(isId(low, high));
-        if (candidate == trans_.end()) {
+        const int faceIdx = low < 0 ? -1 : faceIndex(low, high);
+        if (faceIdx < 0) {
             const auto& location = nnc_input.edit_location( *nnc );
             auto warning = make_warning(location, *nnc);
             OpmLog::warning("EDITNNC", warning);
@@ -909,9 +1064,11 @@ applyEditNncToGridTrans_(const std::vector<int>& globalToLocal)
             warning_count++;
         }
         else {
-            // NNC exists
+            // NNC exists, it is only scaled if it has been recomputed
+            const bool apply = updatedFaces.empty() || updatedFaces[faceIdx];
             while (nnc!= end && c1==nnc->cell1 && c2==nnc->cell2) {
-                candidate->second *= nnc->trans;
+                if (apply)
+                    trans_[faceIdx] *= nnc->trans;
                 ++nnc;
             }
         }
@@ -37,7 +37,6 @@
 #include <map>
 #include <tuple>
 #include <vector>
-#include <unordered_map>
 
 namespace Opm {
 
@@ -124,9 +123,57 @@ public:
      * \param global If true, update is called on all processes
      * Also, this updates the "thermal half transmissibilities" if energy is enabled.
      */
-    void update(bool global);
+    void update(bool global)
+    { update_(global, nullptr); }
+
+    /*!
+     * \brief Return the transmissibility multipliers of the six faces of each
+     *        element, in the order X-, X+, Y-, Y+, Z-, Z+.
+     *
+     * This is used as a snapshot before the multipliers are modified by the
+     * SCHEDULE section, see updateModifiedMultipliers().
+     */
+    std::vector<double> faceMultipliers() const;
+
+    /*!
+     * \brief Recompute the transmissibilities of the faces of the elements
+     *        whose multipliers differ from the given snapshot.
+     *
+     * Falls back to recomputing all faces if the multipliers cannot be
+     * attributed to individual faces (MULTZ option ALL, TRAN{XYZ} edits).
+     * This needs to be called on all processes.
+     */
+    void updateModifiedMultipliers(const std::vector<double>& oldMultipliers);
+
+    /*!
+     * \brief Return the number of faces between two elements of the grid.
+     *
+     * This includes the non-neighbouring connections that are represented
+     * by intersections of the grid.
+     */
+    unsigned numFaces() const
+    { return trans_.size(); }
+
+    /*!
+     * \brief Return the index of the face between two elements or -1 if the
+     *        elements are not connected.
+     */
+    int faceIndex(unsigned elemIdx1, unsigned elemIdx2) const;
 
 protected:
+    /// \brief Compute the transmissibilities of the faces of the given
+    ///        elements, or of all faces if modifiedElements is null.
+    void update_(bool global, const std::vector<bool>* modifiedElements);
+
+    /// \brief Whether the transmissibilities are edited by TRAN{XYZ}.
+    bool tranActive_(bool global) const;
+
+    /// \brief Set up the face table from the intersections of the grid.
+    void buildFaceTable_(const ElementMapper& elemMapper);
+
+    /// \brief Position of elemIdx2 in the neighbour list of elemIdx1 or -1.
+    int neighbourEntry_(unsigned elemIdx1, unsigned elemIdx2) const;
+
     void updateFromEclState_(bool global);
 
     void removeSmallNonCartesianTransmissibilities_();
@@ -189,15 +236,20 @@ protected:
      *
      * \param cartesianToCompressed Vector containing the compressed index (or -1 for inactive
      *                              cells) as the element at the cartesian index.
+     * \param updatedFaces If not empty, only the NNCs of the faces flagged here are applied.
      * \return Two vector of NNCs (scaled by EDITNNC). The first one are the NNCs that have been applied
      *         and the second the NNCs not resembled by faces of the grid. NNCs specified for
      *         inactive cells are omitted in these vectors.
      */
     std::tuple<std::vector<NNCdata>, std::vector<NNCdata>>
-    applyNncToGridTrans_(const std::vector<int>& cartesianToCompressed);
+    applyNncToGridTrans_(const std::vector<int>& cartesianToCompressed,
+                         const std::vector<bool>& updatedFaces);
 
     /// \brief Multiplies the grid transmissibilities according to EDITNNC.
-    void applyEditNncToGridTrans_(const std::vector<int>& globalToLocal);
+    ///
+    /// \param updatedFaces If not empty, only the faces flagged here are scaled.
+    void applyEditNncToGridTrans_(const std::vector<int>& globalToLocal,
+                                  const std::vector<bool>& updatedFaces);
 
     void extractPermeability_();
 
@@ -231,7 +283,17 @@ protected:
 
     std::vector<DimMatrix> permeability_;
     std::vector<Scalar> porosity_;
-    std::unordered_map<std::uint64_t, Scalar> trans_;
+
+    // Face table in compressed sparse row format: the neighbours of element i
+    // are stored in ascending order in neighbours_[neighbourOffsets_[i]] to
+    // neighbours_[neighbourOffsets_[i + 1] - 1], and neighbourFace_ maps each
+    // of these entries to the index of the face in trans_ and diffusivity_.
+    // thermalHalfTrans_ is directional and indexed by the entries themselves.
+    std::vector<unsigned> neighbourOffsets_;
+    std::vector<unsigned> neighbours_;
+    std::vector<unsigned> neighbourFace_;
+
+    std::vector<Scalar> trans_;
     const EclipseState& eclState_;
     const GridView& gridView_;
     const Dune::CartesianIndexMapper<Grid>& cartMapper_;
@@ -242,8 +304,8 @@ protected:
     std::map<std::pair<unsigned, unsigned>, Scalar> thermalHalfTransBoundary_;
     bool enableEnergy_;
     bool enableDiffusivity_;
-    std::unordered_map<std::uint64_t, Scalar> thermalHalfTrans_;
-    std::unordered_map<std::uint64_t, Scalar> diffusivity_;
+    std::vector<Scalar> thermalHalfTrans_;
+    std::vector<Scalar> diffusivity_;
 };
 
 } // namespace Opm
@@ -34,6 +34,7 @@
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
 
 #include <opm/simulators/utils/ParallelRestart.hpp>
+#include <opm/simulators/utils/PerformanceTrace.hpp>
 
 #include <ebos/eclgenericwriter.hh>
 
@@ -176,21 +177,26 @@ public:
 
         const auto localAquiferData = simulator_.problem().aquiferModel().aquiferData();
 
-        this->prepareLocalCellData(isSubStep, reportStepNum);
+        this->prepareLocalCellData(isSubStep, reportStepNum, /*summaryOnly=*/true);
 
-        if (this->collectToIORank_.isParallel())
+        if (this->collectToIORank_.isParallel()) {
+            OPM_TRACE_SCOPE("summary_gather");
             this->collectToIORank_.collect({},
                                            eclOutputModule_->getBlockData(),
                                            eclOutputModule_->getWBPData(),
                                            localWellData,
                                            localGroupAndNetworkData,
                                            localAquiferData);
-
+        }
 
         std::map<std::string, double> miscSummaryData;
         std::map<std::string, std::vector<double>> regionData;
         auto inplace = eclOutputModule_->outputFipLog(miscSummaryData, regionData, isSubStep, simulator_.gridView().comm());
 
+        // the report step logs read the summary state of the previous step
+        if (!isSubStep)
+            this->waitForSummary();
+
         bool forceDisableProdOutput = false;
         bool forceDisableInjOutput = false;
         bool forceDisableCumOutput = false;
@@ -223,7 +229,7 @@ public:
     {
         const int reportStepNum = simulator_.episodeIndex() + 1;
 
-        this->prepareLocalCellData(isSubStep, reportStepNum);
+        this->prepareLocalCellData(isSubStep, reportStepNum, /*summaryOnly=*/false);
         this->eclOutputModule_->outputErrorLog(simulator_.gridView().comm());
 
         // output using eclWriter if enabled
@@ -242,6 +248,7 @@ public:
         }
 
         if (this->collectToIORank_.isParallel()) {
+            OPM_TRACE_SCOPE("output_gather");
             this->collectToIORank_.collect(localCellData,
                                            eclOutputModule_->getBlockData(),
                                            eclOutputModule_->getWBPData(),
@@ -336,6 +343,9 @@ public:
     const EclOutputBlackOilModule<TypeTag>& eclOutputModule() const
     { return *eclOutputModule_; }
 
+    EclOutputBlackOilModule<TypeTag>& eclOutputModule()
+    { return *eclOutputModule_; }
+
     Scalar restartTimeStepSize() const
     { return restartTimeStepSize_; }
 
@@ -359,14 +369,15 @@ private:
     { return simulator_.vanguard().schedule(); }
 
     void prepareLocalCellData(const bool isSubStep,
-                              const int  reportStepNum)
+                              const int  reportStepNum,
+                              const bool summaryOnly)
     {
         const auto& gridView = simulator_.vanguard().gridView();
         const int numElements = gridView.size(/*codim=*/0);
         const bool log = this->collectToIORank_.isIORank();
 
         eclOutputModule_->allocBuffers(numElements, reportStepNum,
-                                      isSubStep, log, /*isRestart*/ false);
+                                      isSubStep, log, /*isRestart*/ false, summaryOnly);
 
         ElementContext elemCtx(simulator_);
         ElementIterator elemIt = gridView.template begin</*codim=*/0>();
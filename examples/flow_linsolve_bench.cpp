@@ -0,0 +1,182 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Replay linear systems written by flow with --capture-linear-systems through
+// the flexible solver, to compare solver configurations without running the
+// simulator:
+//
+//   flow_linsolve_bench <solver.json> <system.bin> [<system.bin> ...]
+//
+// The solver configuration is the same property tree as given to flow with
+// --linear-solver-configuration-json-file. Captured well contributions are
+// added to the reservoir matrix. Each file is solved serially, for a capture
+// from a parallel run that is the local system of one process only.
+
+#include <config.h>
+
+#include <opm/simulators/linalg/FlexibleSolver.hpp>
+#include <opm/simulators/linalg/LinearSystemCapture.hpp>
+#include <opm/simulators/linalg/MatrixBlock.hpp>
+#include <opm/simulators/linalg/PropertyTree.hpp>
+#include <opm/simulators/linalg/getQuasiImpesWeights.hpp>
+
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/common/timer.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/istl/operators.hh>
+
+#include <sys/resource.h>
+
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Sum of the reservoir matrix and the well contributions, over the union of
+// their sparsity patterns.
+template <class Matrix>
+Matrix addWellMatrix(const Matrix& matrix, const Matrix& wellMatrix)
+{
+    Matrix sum(matrix.N(), matrix.M(), Matrix::row_wise);
+    for (auto row = sum.createbegin(); row != sum.createend(); ++row) {
+        const auto i = row.index();
+        for (auto col = matrix[i].begin(); col != matrix[i].end(); ++col) {
+            row.insert(col.index());
+        }
+        if (i < wellMatrix.N()) {
+            for (auto col = wellMatrix[i].begin(); col != wellMatrix[i].end(); ++col) {
+                row.insert(col.index());
+            }
+        }
+    }
+    sum = 0.0;
+    for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+        for (auto col = row->begin(); col != row->end(); ++col) {
+            sum[row.index()][col.index()] += *col;
+        }
+    }
+    for (auto row = wellMatrix.begin(); row != wellMatrix.end(); ++row) {
+        for (auto col = row->begin(); col != row->end(); ++col) {
+            sum[row.index()][col.index()] += *col;
+        }
+    }
+    return sum;
+}
+
+// Peak resident set size of the whole process so far in MiB. It includes
+// everything allocated before, e.g. by systems benchmarked earlier.
+double processPeakMemory()
+{
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;
+}
+
+template <int bz>
+void benchSystem(const Opm::PropertyTree& prm, const std::string& filename)
+{
+    using Matrix = Dune::BCRSMatrix<Opm::MatrixBlock<double, bz, bz>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<double, bz>>;
+
+    // the growth of the process peak is the memory needed by this system,
+    // as long as it needs more than the systems benchmarked before
+    const double peakBefore = processPeakMemory();
+    Matrix matrix, wellMatrix;
+    Vector rhs, weights;
+    Opm::LinearSystemCapture::read(filename, matrix, rhs, wellMatrix, weights);
+    if (wellMatrix.N() > 0) {
+        matrix = addWellMatrix(matrix, wellMatrix);
+    }
+
+    // Use the captured CPR weights if present, otherwise quasi-IMPES weights
+    // computed from the (well augmented) matrix.
+    const bool transpose = prm.get<std::string>("preconditioner.type", "cpr") == "cprt";
+    const int pressureIndex = prm.get<int>("preconditioner.pressure_var_index", 1);
+    std::function<Vector()> weightsCalculator = [&]() {
+        if (weights.size() == matrix.N()) {
+            return weights;
+        }
+        return Opm::Amg::getQuasiImpesWeights<Matrix, Vector>(matrix, pressureIndex, transpose);
+    };
+
+    using Operator = Dune::MatrixAdapter<Matrix, Vector, Vector>;
+    Operator op(matrix);
+
+    Dune::Timer timer;
+    Dune::FlexibleSolver<Matrix, Vector> solver(op, prm, weightsCalculator);
+    const double setupTime = timer.elapsed();
+
+    Vector x(rhs.size());
+    x = 0.0;
+    Dune::InverseOperatorResult result;
+    timer.reset();
+    solver.apply(x, rhs, result);
+    const double applyTime = timer.elapsed();
+
+    std::cout << filename << ": " << matrix.N() << " rows, block size " << bz
+              << ", " << matrix.nonzeroes() << " nonzero blocks"
+              << (wellMatrix.N() > 0 ? " (with wells)" : "") << '\n'
+              << "  setup " << std::fixed << std::setprecision(3) << setupTime << " s"
+              << ", apply " << applyTime << " s"
+              << ", " << result.iterations << " iterations"
+              << ", reduction " << std::scientific << std::setprecision(2) << result.reduction
+              << (result.converged ? "" : " (not converged)")
+              << ", process peak memory " << std::fixed << std::setprecision(1) << processPeakMemory() << " MiB"
+              << " (+" << processPeakMemory() - peakBefore << " MiB)"
+              << std::endl;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <solver.json> <system.bin> [<system.bin> ...]\n";
+        return EXIT_FAILURE;
+    }
+
+    try {
+        const Opm::PropertyTree prm(argv[1]);
+        for (int i = 2; i < argc; ++i) {
+            const std::string filename(argv[i]);
+            switch (Opm::LinearSystemCapture::blockSize(filename)) {
+            case 1: benchSystem<1>(prm, filename); break;
+            case 2: benchSystem<2>(prm, filename); break;
+            case 3: benchSystem<3>(prm, filename); break;
+            case 4: benchSystem<4>(prm, filename); break;
+            default:
+                std::cerr << filename << ": unsupported block size\n";
+                return EXIT_FAILURE;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
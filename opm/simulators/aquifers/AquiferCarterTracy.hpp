@@ -93,6 +93,16 @@ public:
         return data;
     }
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        Base::serializeOp(serializer);
+        serializer(this->beta_);
+        serializer(this->fluxValue_);
+        serializer(this->dimensionless_time_);
+        serializer(this->dimensionless_pressure_);
+    }
+
 protected:
     // Variables constants
     AquiferCT::AQUCT_data aquct_data_;
@@ -92,6 +92,13 @@ public:
         return data;
     }
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        Base::serializeOp(serializer);
+        serializer(this->aquifer_pressure_);
+    }
+
 protected:
     // Aquifer Fetkovich Specific Variables
     Aquifetp::AQUFETP_data aqufetp_data_;
@@ -158,6 +158,22 @@ public:
 
     int aquiferID() const { return this->aquiferID_; }
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(this->pressure_previous_);
+        serializer(this->Tc_);
+        serializer(this->pa0_);
+        serializer(this->rhow_);
+        serializer(this->solution_set_from_restart_);
+
+        // only the value of the cumulative flux carries over time steps
+        Scalar w_flux = this->W_flux_.value();
+        serializer(w_flux);
+        if (!serializer.isSerializing())
+            this->W_flux_ = w_flux;
+    }
+
 protected:
     inline Scalar gravity_() const
     {
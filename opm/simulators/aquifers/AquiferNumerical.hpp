@@ -24,7 +24,13 @@
 #include <opm/output/data/Aquifer.hpp>
 #include <opm/parser/eclipse/EclipseState/Aquifer/NumericalAquifer/SingleNumericalAquifer.hpp>
 
+#include <dune/grid/common/partitionset.hh>
+#include <dune/grid/common/rangegenerators.hh>
+
+#include <algorithm>
+#include <optional>
 #include <utility>
+#include <vector>
 
 namespace Opm
 {
@@ -61,7 +67,8 @@ public:
         , global_cell_(global_cell)
         , init_pressure_(aquifer.numCells(), 0.0)
     {
-        this->cell_to_aquifer_cell_idx_.resize(this->ebos_simulator_.gridView().size(/*codim=*/0), -1);
+        const auto& gridView = this->ebos_simulator_.gridView();
+        this->cell_to_aquifer_cell_idx_.resize(gridView.size(/*codim=*/0), -1);
 
         for (size_t idx = 0; idx < aquifer.numCells(); ++idx) {
             const auto* cell = aquifer.getCellPrt(idx);
@@ -72,6 +79,21 @@ public:
                 this->cell_to_aquifer_cell_idx_[search->second] = idx;
             }
         }
+
+        // the interior aquifer cells of this process, such that the pressure
+        // and flux calculations do not need to visit the whole grid
+        const auto& indexSet = gridView.indexSet();
+        for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
+            const unsigned cell_index = indexSet.index(elem);
+            const int idx = this->cell_to_aquifer_cell_idx_[cell_index];
+            if (idx < 0) {
+                continue;
+            }
+            this->local_cells_.push_back({elem, cell_index, idx});
+            if (idx == 0) {
+                this->first_cell_ = this->local_cells_.size() - 1;
+            }
+        }
     }
 
     void initFromRestart([[maybe_unused]]const data::Aquifers& aquiferSoln)
@@ -79,10 +101,34 @@ public:
         // NOT handling Restart for now
     }
 
-    void endTimeStep()
+    /*!
+     * \brief Number of values contributed to the reduction over all
+     *        processes by localSums().
+     */
+    std::size_t numSums() const
+    {
+        return 3 + this->init_pressure_.size();
+    }
+
+    /*!
+     * \brief Write the contributions of this process to the aquifer pressure
+     *        and flux to sums[0, numSums()).
+     *
+     * The values are summed over all processes by the aquifer model, in a
+     * single collective for all numerical aquifers, before being passed to
+     * endTimeStep() or initialSolutionApplied().
+     */
+    void localSums(double* sums) const
+    {
+        std::fill(sums, sums + this->numSums(), 0.0);
+        this->calculateLocalPressureSums(sums[0], sums[1], sums + 3);
+        sums[2] = this->calculateLocalFluxRate();
+    }
+
+    void endTimeStep(const double* sums)
     {
-        this->pressure_ = this->calculateAquiferPressure();
-        this->flux_rate_ = this->calculateAquiferFluxRate();
+        this->pressure_ = sums[0] / sums[1];
+        this->flux_rate_ = sums[2];
         this->cumulative_flux_ += this->flux_rate_ * this->ebos_simulator_.timeStepSize();
     }
 
@@ -100,9 +146,10 @@ public:
         return data;
     }
 
-    void initialSolutionApplied()
+    void initialSolutionApplied(const double* sums)
     {
-        this->pressure_ = this->calculateAquiferPressure(this->init_pressure_);
+        this->pressure_ = sums[0] / sums[1];
+        std::copy(sums + 3, sums + this->numSums(), this->init_pressure_.begin());
         this->flux_rate_ = 0.;
         this->cumulative_flux_ = 0.;
     }
@@ -112,7 +159,25 @@ public:
         return static_cast<int>(this->id_);
     }
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(this->flux_rate_);
+        serializer(this->cumulative_flux_);
+        serializer(this->init_pressure_);
+        serializer(this->pressure_);
+    }
+
 private:
+    using Element = typename GridView::template Codim<0>::Entity;
+
+    struct LocalCell
+    {
+        Element element;
+        unsigned cell_index; // compressed index
+        int aquifer_cell_idx;
+    };
+
     const size_t id_;
     const Simulator& ebos_simulator_;
     double flux_rate_; // aquifer influx rate
@@ -124,121 +189,97 @@ private:
     // TODO: maybe unordered_map can also do the work to save memory?
     std::vector<int> cell_to_aquifer_cell_idx_;
 
-    double calculateAquiferPressure() const
-    {
-        auto capture = std::vector<double>(this->init_pressure_.size(), 0.0);
-        return this->calculateAquiferPressure(capture);
-    }
-
-    double calculateAquiferPressure(std::vector<double>& cell_pressure) const
+    // interior aquifer cells of this process
+    std::vector<LocalCell> local_cells_;
+    // position of the first aquifer cell in local_cells_, if it is interior to this process
+    std::optional<std::size_t> first_cell_;
+    // stencil faces of the first aquifer cell connecting it to the reservoir,
+    // determined on first use
+    mutable std::optional<std::vector<unsigned>> connection_faces_;
+
+    void calculateLocalPressureSums(double& sum_pressure_watervolume,
+                                    double& sum_watervolume,
+                                    double* cell_pressure) const
     {
-        double sum_pressure_watervolume = 0.;
-        double sum_watervolume = 0.;
-
-        ElementContext  elem_ctx(this->ebos_simulator_);
-        const auto& gridView = this->ebos_simulator_.gridView();
-        auto elemIt = gridView.template begin</*codim=*/0>();
-        const auto& elemEndIt = gridView.template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const auto& elem = *elemIt;
-            if (elem.partitionType() != Dune::InteriorEntity) {
-                continue;
-            }
-            elem_ctx.updatePrimaryStencil(elem);
-
-            const size_t cell_index = elem_ctx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const int idx = this->cell_to_aquifer_cell_idx_[cell_index];
-            if (idx < 0) {
-                continue;
+        const auto& model = this->ebos_simulator_.model();
+        std::optional<ElementContext> elem_ctx;
+        for (const auto& cell : this->local_cells_) {
+            // use the cached intensive quantities if they are up to date,
+            // they are not during initialization
+            const auto* iq0 = model.cachedIntensiveQuantities(cell.cell_index, /*timeIdx=*/0);
+            if (!iq0) {
+                if (!elem_ctx) {
+                    elem_ctx.emplace(this->ebos_simulator_);
+                }
+                elem_ctx->updatePrimaryStencil(cell.element);
+                elem_ctx->updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+                iq0 = &elem_ctx->intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
             }
-
-            elem_ctx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-            const auto& iq0 = elem_ctx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto& fs = iq0.fluidState();
+            const auto& fs = iq0->fluidState();
 
             // TODO: the porosity of the cells are still wrong for numerical aquifer cells
             // Because the dofVolume still based on the grid information.
             // The pore volume is correct. Extra efforts will be done to get sensible porosity value here later.
             const double water_saturation = fs.saturation(waterPhaseIdx).value();
-            const double porosity = iq0.porosity().value();
-            const double volume = elem_ctx.dofTotalVolume(0, 0);
+            const double porosity = iq0->porosity().value();
+            const double volume = model.dofTotalVolume(cell.cell_index);
             // TODO: not sure we should use water pressure here
             const double water_pressure_reservoir = fs.pressure(waterPhaseIdx).value();
             const double water_volume = volume * porosity * water_saturation;
             sum_pressure_watervolume += water_volume * water_pressure_reservoir;
             sum_watervolume += water_volume;
 
-            cell_pressure[idx] = water_pressure_reservoir;
+            cell_pressure[cell.aquifer_cell_idx] = water_pressure_reservoir;
         }
-
-        const auto& comm = this->ebos_simulator_.vanguard().grid().comm();
-        comm.sum(&sum_pressure_watervolume, 1);
-        comm.sum(&sum_watervolume, 1);
-
-        // Ensure all processes have same notion of the aquifer cells' pressure values.
-        comm.sum(cell_pressure.data(), cell_pressure.size());
-
-        return sum_pressure_watervolume / sum_watervolume;
     }
 
-    double calculateAquiferFluxRate() const
+    double calculateLocalFluxRate() const
     {
-        double aquifer_flux = 0.;
-
-        ElementContext  elem_ctx(this->ebos_simulator_);
-        const auto& gridView = this->ebos_simulator_.gridView();
-        auto elemIt = gridView.template begin</*codim=*/0>();
-        const auto& elemEndIt = gridView.template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const auto &elem = *elemIt;
-            if (elem.partitionType() != Dune::InteriorEntity) {
-                continue;
-            }
-            // elem_ctx.updatePrimaryStencil(elem);
-            elem_ctx.updateStencil(elem);
+        // we only need the first aquifer cell, which is interior to one process only
+        if (!this->first_cell_) {
+            return 0.;
+        }
+        const auto& cell = this->local_cells_[*this->first_cell_];
 
-            const size_t cell_index = elem_ctx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const int idx = this->cell_to_aquifer_cell_idx_[cell_index];
-            // we only need the first aquifer cell
-            if (idx != 0) {
-                continue;
-            }
-            elem_ctx.updateAllIntensiveQuantities();
-            elem_ctx.updateAllExtensiveQuantities();
+        ElementContext elem_ctx(this->ebos_simulator_);
+        elem_ctx.updateStencil(cell.element);
+        const auto& stencil = elem_ctx.stencil(/*timeIdx*/ 0);
 
+        if (!this->connection_faces_) {
+            auto& faces = this->connection_faces_.emplace();
             const size_t num_interior_faces = elem_ctx.numInteriorFaces(/*timeIdx*/ 0);
-            // const auto &problem = elem_ctx.problem();
-            const auto &stencil = elem_ctx.stencil(0);
-            // const auto& inQuants = elem_ctx.intensiveQuantities(0, /*timeIdx*/ 0);
-
             for (size_t face_idx = 0; face_idx < num_interior_faces; ++face_idx) {
-                const auto &face = stencil.interiorFace(face_idx);
-                // dof index
-                const size_t i = face.interiorIndex();
-                const size_t j = face.exteriorIndex();
-                // compressed index
-                // const size_t I = stencil.globalSpaceIndex(i);
-                const size_t J = stencil.globalSpaceIndex(j);
-
-                assert(stencil.globalSpaceIndex(i) == cell_index);
+                const auto& face = stencil.interiorFace(face_idx);
+                assert(stencil.globalSpaceIndex(face.interiorIndex()) == cell.cell_index);
 
                 // we do not consider the flux within aquifer cells
                 // we only need the flux to the connections
+                const size_t J = stencil.globalSpaceIndex(face.exteriorIndex());
                 if (this->cell_to_aquifer_cell_idx_[J] > 0) {
                     continue;
                 }
-                const auto &exQuants = elem_ctx.extensiveQuantities(face_idx, /*timeIdx*/ 0);
-                const double water_flux = Toolbox::value(exQuants.volumeFlux(waterPhaseIdx));
-
-                const size_t up_id = water_flux >= 0. ? i : j;
-                const auto &intQuantsIn = elem_ctx.intensiveQuantities(up_id, 0);
-                const double invB = Toolbox::value(intQuantsIn.fluidState().invB(waterPhaseIdx));
-                const double face_area = face.area();
-                aquifer_flux += water_flux * invB * face_area;
+                faces.push_back(face_idx);
             }
+        }
+
+        elem_ctx.updateAllIntensiveQuantities();
+        elem_ctx.updateAllExtensiveQuantities();
 
-            // we only need to handle the first aquifer cell, we can exit loop here
-            break;
+        double aquifer_flux = 0.;
+        for (const unsigned face_idx : *this->connection_faces_) {
+            const auto& face = stencil.interiorFace(face_idx);
+            // dof index
+            const size_t i = face.interiorIndex();
+            const size_t j = face.exteriorIndex();
+
+            const auto& exQuants = elem_ctx.extensiveQuantities(face_idx, /*timeIdx*/ 0);
+            const double water_flux = Toolbox::value(exQuants.volumeFlux(waterPhaseIdx));
+
+            const size_t up_id = water_flux >= 0. ? i : j;
+            const auto& intQuantsIn = elem_ctx.intensiveQuantities(up_id, 0);
+            const double invB = Toolbox::value(intQuantsIn.fluidState().invB(waterPhaseIdx));
+            const double face_area = face.area();
+            aquifer_flux += water_flux * invB * face_area;
         }
 
         return aquifer_flux;
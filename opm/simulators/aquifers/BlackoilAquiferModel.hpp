@@ -107,6 +107,10 @@ public:
     template <class Restarter>
     void deserialize(Restarter& res);
 
+    // The state of all aquifers, for checkpointing.
+    template <class Serializer>
+    void serializeOp(Serializer& serializer);
+
 protected:
     // ---------      Types      ---------
     using ElementContext = GetPropType<TypeTag, Properties::ElementContext>;
@@ -130,6 +134,10 @@ protected:
     bool aquiferCarterTracyActive() const;
     bool aquiferFetkovichActive() const;
     bool aquiferNumericalActive() const;
+
+    // Local contributions of all numerical aquifers summed over all processes,
+    // consecutive segments of AquiferNumerical::numSums() values per aquifer.
+    std::vector<double> numericalAquiferSums() const;
 };
 
 
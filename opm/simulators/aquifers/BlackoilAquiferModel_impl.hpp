@@ -51,8 +51,11 @@ BlackoilAquiferModel<TypeTag>::initialSolutionApplied()
     }
 
     if (this->aquiferNumericalActive()) {
+        const auto sums = this->numericalAquiferSums();
+        const double* aquiferSums = sums.data();
         for (auto& aquifer : this->aquifers_numerical) {
-            aquifer.initialSolutionApplied();
+            aquifer.initialSolutionApplied(aquiferSums);
+            aquiferSums += aquifer.numSums();
         }
     }
 }
@@ -146,9 +149,11 @@ BlackoilAquiferModel<TypeTag>::endTimeStep()
         }
     }
     if (aquiferNumericalActive()) {
+        const auto sums = this->numericalAquiferSums();
+        const double* aquiferSums = sums.data();
         for (auto& aquifer : this->aquifers_numerical) {
-            aquifer.endTimeStep();
-            this->simulator_.vanguard().grid().comm().barrier();
+            aquifer.endTimeStep(aquiferSums);
+            aquiferSums += aquifer.numSums();
         }
     }
 }
@@ -176,6 +181,22 @@ BlackoilAquiferModel<TypeTag>::deserialize(Restarter& /* res */)
     throw std::logic_error("BlackoilAquiferModel::deserialize() is not yet implemented");
 }
 
+template <typename TypeTag>
+template <class Serializer>
+void
+BlackoilAquiferModel<TypeTag>::serializeOp(Serializer& serializer)
+{
+    for (auto& aquifer : this->aquifers_CarterTracy) {
+        aquifer.serializeOp(serializer);
+    }
+    for (auto& aquifer : this->aquifers_Fetkovich) {
+        aquifer.serializeOp(serializer);
+    }
+    for (auto& aquifer : this->aquifers_numerical) {
+        aquifer.serializeOp(serializer);
+    }
+}
+
 // Initialize the aquifers in the deck
 template <typename TypeTag>
 void
@@ -234,6 +255,28 @@ BlackoilAquiferModel<TypeTag>::aquiferNumericalActive() const
     return !(this->aquifers_numerical.empty());
 }
 
+template<typename TypeTag>
+std::vector<double>
+BlackoilAquiferModel<TypeTag>::numericalAquiferSums() const
+{
+    std::size_t size = 0;
+    for (const auto& aquifer : this->aquifers_numerical) {
+        size += aquifer.numSums();
+    }
+
+    std::vector<double> sums(size, 0.0);
+    double* aquiferSums = sums.data();
+    for (const auto& aquifer : this->aquifers_numerical) {
+        aquifer.localSums(aquiferSums);
+        aquiferSums += aquifer.numSums();
+    }
+
+    // one collective for all the numerical aquifers
+    this->simulator_.vanguard().grid().comm().sum(sums.data(), sums.size());
+
+    return sums;
+}
+
 template<typename TypeTag>
 data::Aquifers BlackoilAquiferModel<TypeTag>::aquiferData() const
 {
@@ -39,6 +39,7 @@
 #include <opm/grid/UnstructuredGrid.h>
 #include <opm/simulators/timestepping/SimulatorReport.hpp>
 #include <opm/simulators/linalg/ParallelIstlInformation.hpp>
+#include <opm/simulators/utils/PerformanceTrace.hpp>
 #include <opm/core/props/phaseUsageFromDeck.hpp>
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/Exceptions.hpp>
@@ -60,11 +61,13 @@
 #include <dune/common/timer.hh>
 #include <dune/common/unused.hh>
 
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <memory>
 #include <vector>
 #include <algorithm>
 
@@ -154,6 +157,9 @@ namespace Opm {
         using Simulator = GetPropType<TypeTag, Properties::Simulator>;
         using Grid = GetPropType<TypeTag, Properties::Grid>;
         using ElementContext = GetPropType<TypeTag, Properties::ElementContext>;
+        using GridView = GetPropType<TypeTag, Properties::GridView>;
+        using Element = typename GridView::template Codim<0>::Entity;
+        using ThreadManager = GetPropType<TypeTag, Properties::ThreadManager>;
         using SparseMatrixAdapter = GetPropType<TypeTag, Properties::SparseMatrixAdapter>;
         using SolutionVector = GetPropType<TypeTag, Properties::SolutionVector>;
         using PrimaryVariables = GetPropType<TypeTag, Properties::PrimaryVariables>;
@@ -215,6 +221,17 @@ namespace Opm {
             // compute global sum of number of cells
             global_nc_ = detail::countGlobalCells(grid_);
             convergence_reports_.reserve(300); // Often insufficient, but avoids frequent moves.
+
+            const auto& gridView = ebosSimulator_.gridView();
+            for (const auto& elem : elements(gridView, Dune::Partitions::interior))
+                interiorElements_.push_back(elem);
+            for (const auto& elem : elements(gridView, Dune::Partitions::interiorBorder))
+                interiorBorderElements_.push_back(elem);
+
+            // the element contexts are created up front, such that they do
+            // not need to be created from within the threaded loops
+            for (int threadId = 0; threadId < ThreadManager::maxThreads(); ++threadId)
+                elementCtx_.push_back(std::make_unique<ElementContext>(ebosSimulator_));
         }
 
         bool isParallel() const
@@ -284,6 +301,7 @@ namespace Opm {
                 // For each iteration we store in a vector the norms of the residual of
                 // the mass balance for each active phase, the well flux and the well equations.
                 residual_norms_history_.clear();
+                linear_solve_failures_ = 0;
                 current_relaxation_ = 1.0;
                 dx_old_ = 0.0;
                 convergence_reports_.push_back({timer.reportStepNum(), timer.currentStepNum(), {}});
@@ -308,6 +326,7 @@ namespace Opm {
             perfTimer.start();
             // the step is not considered converged until at least minIter iterations is done
             {
+                OPM_TRACE_SCOPE("convergence_check");
                 auto convrep = getConvergence(timer, iteration,residual_norms);
                 report.converged = convrep.converged()  && iteration > nonlinear_solver.minIter();;
                 ConvergenceReport::Severity severity = convrep.severityOfWorstFailure();
@@ -336,13 +355,20 @@ namespace Opm {
 
                 // apply the Schur compliment of the well model to the reservoir linearized
                 // equations
-                wellModel().linearize(ebosSimulator().model().linearizer().jacobian(),
-                                      ebosSimulator().model().linearizer().residual());
+                {
+                    OPM_TRACE_SCOPE("well_linearize");
+                    wellModel().linearize(ebosSimulator().model().linearizer().jacobian(),
+                                          ebosSimulator().model().linearizer().residual());
+                }
 
                 // Solve the linear system.
                 linear_solve_setup_time_ = 0.0;
                 try {
-                    solveJacobianSystem(x);
+                    if (solveJacobianSystem(x)) {
+                        linear_solve_failures_ = 0;
+                    } else {
+                        ++linear_solve_failures_;
+                    }
                     report.linear_solve_setup_time += linear_solve_setup_time_;
                     report.linear_solve_time += perfTimer.stop();
                     report.total_linear_iterations += linearIterationsLastSolve();
@@ -418,6 +444,7 @@ namespace Opm {
         SimulatorReportSingle assembleReservoir(const SimulatorTimerInterface& /* timer */,
                                                 const int iterationIdx)
         {
+            OPM_TRACE_SCOPE("assemble_reservoir");
             // -------- Mass balance equations --------
             ebosSimulator_.model().newtonMethod().setIterationIndex(iterationIdx);
             ebosSimulator_.problem().beginIteration();
@@ -430,82 +457,86 @@ namespace Opm {
         // compute the "relative" change of the solution between time steps
         double relativeChange() const
         {
-            Scalar resultDelta = 0.0;
-            Scalar resultDenom = 0.0;
-
             const auto& elemMapper = ebosSimulator_.model().elementMapper();
             const auto& gridView = ebosSimulator_.gridView();
-            auto elemIt = gridView.template begin</*codim=*/0>();
-            const auto& elemEndIt = gridView.template end</*codim=*/0>();
-            for (; elemIt != elemEndIt; ++elemIt) {
-                const auto& elem = *elemIt;
-                if (elem.partitionType() != Dune::InteriorEntity)
-                    continue;
-
-                unsigned globalElemIdx = elemMapper.index(elem);
-                const auto& priVarsNew = ebosSimulator_.model().solution(/*timeIdx=*/0)[globalElemIdx];
-
-                Scalar pressureNew;
-                pressureNew = priVarsNew[Indices::pressureSwitchIdx];
-
-                Scalar saturationsNew[FluidSystem::numPhases] = { 0.0 };
-                Scalar oilSaturationNew = 1.0;
-                if (FluidSystem::phaseIsActive(FluidSystem::waterPhaseIdx)) {
-                    saturationsNew[FluidSystem::waterPhaseIdx] = priVarsNew[Indices::waterSaturationIdx];
-                    oilSaturationNew -= saturationsNew[FluidSystem::waterPhaseIdx];
-                }
-
-                if (FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx) && priVarsNew.primaryVarsMeaning() == PrimaryVariables::Sw_po_Sg) {
-                    saturationsNew[FluidSystem::gasPhaseIdx] = priVarsNew[Indices::compositionSwitchIdx];
-                    oilSaturationNew -= saturationsNew[FluidSystem::gasPhaseIdx];
-                }
-
-                if (FluidSystem::phaseIsActive(FluidSystem::oilPhaseIdx)) {
-                    saturationsNew[FluidSystem::oilPhaseIdx] = oilSaturationNew;
-                }
 
-                const auto& priVarsOld = ebosSimulator_.model().solution(/*timeIdx=*/1)[globalElemIdx];
-
-                Scalar pressureOld;
-                pressureOld = priVarsOld[Indices::pressureSwitchIdx];
-
-                Scalar saturationsOld[FluidSystem::numPhases] = { 0.0 };
-                Scalar oilSaturationOld = 1.0;
+            const auto partials = chunkedReduce_(interiorElements_.size(), std::array<Scalar, 2>{},
+                [this, &elemMapper](std::size_t begin, std::size_t end, std::array<Scalar, 2>& result)
+            {
+                Scalar& resultDelta = result[0];
+                Scalar& resultDenom = result[1];
+                for (std::size_t i = begin; i < end; ++i) {
+                    unsigned globalElemIdx = elemMapper.index(interiorElements_[i]);
+                    const auto& priVarsNew = ebosSimulator_.model().solution(/*timeIdx=*/0)[globalElemIdx];
 
-                // NB fix me! adding pressures changes to satutation changes does not make sense
-                Scalar tmp = pressureNew - pressureOld;
-                resultDelta += tmp*tmp;
-                resultDenom += pressureNew*pressureNew;
+                    Scalar pressureNew;
+                    pressureNew = priVarsNew[Indices::pressureSwitchIdx];
 
-                if (FluidSystem::numActivePhases() > 1) {
+                    Scalar saturationsNew[FluidSystem::numPhases] = { 0.0 };
+                    Scalar oilSaturationNew = 1.0;
                     if (FluidSystem::phaseIsActive(FluidSystem::waterPhaseIdx)) {
-                        saturationsOld[FluidSystem::waterPhaseIdx] = priVarsOld[Indices::waterSaturationIdx];
-                        oilSaturationOld -= saturationsOld[FluidSystem::waterPhaseIdx];
+                        saturationsNew[FluidSystem::waterPhaseIdx] = priVarsNew[Indices::waterSaturationIdx];
+                        oilSaturationNew -= saturationsNew[FluidSystem::waterPhaseIdx];
                     }
 
-                    if (FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx) &&
-                        priVarsOld.primaryVarsMeaning() == PrimaryVariables::Sw_po_Sg)
-                    {
-                        saturationsOld[FluidSystem::gasPhaseIdx] = priVarsOld[Indices::compositionSwitchIdx];
-                        oilSaturationOld -= saturationsOld[FluidSystem::gasPhaseIdx];
+                    if (FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx) && priVarsNew.primaryVarsMeaning() == PrimaryVariables::Sw_po_Sg) {
+                        saturationsNew[FluidSystem::gasPhaseIdx] = priVarsNew[Indices::compositionSwitchIdx];
+                        oilSaturationNew -= saturationsNew[FluidSystem::gasPhaseIdx];
                     }
 
                     if (FluidSystem::phaseIsActive(FluidSystem::oilPhaseIdx)) {
-                        saturationsOld[FluidSystem::oilPhaseIdx] = oilSaturationOld;
+                        saturationsNew[FluidSystem::oilPhaseIdx] = oilSaturationNew;
                     }
-                    for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++ phaseIdx) {
-                        Scalar tmpSat = saturationsNew[phaseIdx] - saturationsOld[phaseIdx];
-                        resultDelta += tmpSat*tmpSat;
-                        resultDenom += saturationsNew[phaseIdx]*saturationsNew[phaseIdx];
-                        assert(std::isfinite(resultDelta));
-                        assert(std::isfinite(resultDenom));
+
+                    const auto& priVarsOld = ebosSimulator_.model().solution(/*timeIdx=*/1)[globalElemIdx];
+
+                    Scalar pressureOld;
+                    pressureOld = priVarsOld[Indices::pressureSwitchIdx];
+
+                    Scalar saturationsOld[FluidSystem::numPhases] = { 0.0 };
+                    Scalar oilSaturationOld = 1.0;
+
+                    // NB fix me! adding pressures changes to satutation changes does not make sense
+                    Scalar tmp = pressureNew - pressureOld;
+                    resultDelta += tmp*tmp;
+                    resultDenom += pressureNew*pressureNew;
+
+                    if (FluidSystem::numActivePhases() > 1) {
+                        if (FluidSystem::phaseIsActive(FluidSystem::waterPhaseIdx)) {
+                            saturationsOld[FluidSystem::waterPhaseIdx] = priVarsOld[Indices::waterSaturationIdx];
+                            oilSaturationOld -= saturationsOld[FluidSystem::waterPhaseIdx];
+                        }
+
+                        if (FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx) &&
+                            priVarsOld.primaryVarsMeaning() == PrimaryVariables::Sw_po_Sg)
+                        {
+                            saturationsOld[FluidSystem::gasPhaseIdx] = priVarsOld[Indices::compositionSwitchIdx];
+                            oilSaturationOld -= saturationsOld[FluidSystem::gasPhaseIdx];
+                        }
+
+                        if (FluidSystem::phaseIsActive(FluidSystem::oilPhaseIdx)) {
+                            saturationsOld[FluidSystem::oilPhaseIdx] = oilSaturationOld;
+                        }
+                        for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++ phaseIdx) {
+                            Scalar tmpSat = saturationsNew[phaseIdx] - saturationsOld[phaseIdx];
+                            resultDelta += tmpSat*tmpSat;
+                            resultDenom += saturationsNew[phaseIdx]*saturationsNew[phaseIdx];
+                            assert(std::isfinite(resultDelta));
+                            assert(std::isfinite(resultDenom));
+                        }
                     }
                 }
-            }
+            });
 
-            resultDelta = gridView.comm().sum(resultDelta);
-            resultDenom = gridView.comm().sum(resultDenom);
+            Scalar result[2] = { 0.0, 0.0 };
+            for (const auto& partial : partials) {
+                result[0] += partial[0];
+                result[1] += partial[1];
+            }
+            gridView.comm().sum(result, 2);
 
+            const Scalar resultDelta = result[0];
+            const Scalar resultDenom = result[1];
             if (resultDenom > 0.0)
                 return resultDelta/resultDenom;
             return 0.0;
@@ -520,7 +551,8 @@ namespace Opm {
 
         /// Solve the Jacobian system Jx = r where J is the Jacobian and
         /// r is the residual.
-        void solveJacobianSystem(BVector& x)
+        /// \return whether the linear solver converged
+        bool solveJacobianSystem(BVector& x)
         {
 
             auto& ebosJac = ebosSimulator_.model().linearizer().jacobian();
@@ -532,7 +564,10 @@ namespace Opm {
             auto& ebosSolver = ebosSimulator_.model().newtonMethod().linearSolver();
             Dune::Timer perfTimer;
             perfTimer.start();
-            ebosSolver.prepare(ebosJac, ebosResid);
+            {
+                OPM_TRACE_SCOPE("linear_solve_setup");
+                ebosSolver.prepare(ebosJac, ebosResid);
+            }
             linear_solve_setup_time_ = perfTimer.stop();
             ebosSolver.setResidual(ebosResid);
             // actually, the error needs to be calculated after setResidual in order to
@@ -540,7 +575,8 @@ namespace Opm {
             // discretizations does not need to be synchronized across processes to be
             // consistent, this is not relevant for OPM-flow...
             ebosSolver.setMatrix(ebosJac);
-            ebosSolver.solve(x);
+            OPM_TRACE_SCOPE("linear_solve_apply");
+            return ebosSolver.solve(x);
        }
 
 
@@ -548,6 +584,7 @@ namespace Opm {
         /// Apply an update to the primary variables.
         void updateSolution(const BVector& dx)
         {
+            OPM_TRACE_SCOPE("update_solution");
             auto& ebosNewtonMethod = ebosSimulator_.model().newtonMethod();
             SolutionVector& solution = ebosSimulator_.model().solution(/*timeIdx=*/0);
 
@@ -629,95 +666,115 @@ namespace Opm {
                                     std::vector<Scalar>& maxCoeff,
                                     std::vector<Scalar>& B_avg)
         {
-            double pvSumLocal = 0.0;
             const auto& ebosModel = ebosSimulator_.model();
             const auto& ebosProblem = ebosSimulator_.problem();
 
             const auto& ebosResid = ebosSimulator_.model().linearizer().residual();
 
-            ElementContext elemCtx(ebosSimulator_);
-            const auto& gridView = ebosSimulator().gridView();
-            const auto& elemEndIt = gridView.template end</*codim=*/0, Dune::Interior_Partition>();
-
-            for (auto elemIt = gridView.template begin</*codim=*/0, Dune::Interior_Partition>();
-                 elemIt != elemEndIt;
-                 ++elemIt)
+            struct LocalData
+            {
+                double pvSum = 0.0;
+                std::array<Scalar, numEq> R_sum{};
+                std::array<Scalar, numEq> B_avg{};
+                std::array<Scalar, numEq> maxCoeff{};
+            };
+            LocalData init;
+            init.maxCoeff.fill(std::numeric_limits<Scalar>::lowest());
+
+            const auto partials = chunkedReduce_(interiorElements_.size(), init,
+                [&, this](std::size_t begin, std::size_t end, LocalData& local)
             {
-                const auto& elem = *elemIt;
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-                const unsigned cell_idx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& intQuants = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& fs = intQuants.fluidState();
+                auto& R_sum = local.R_sum;
+                auto& B_avg = local.B_avg;
+                auto& maxCoeff = local.maxCoeff;
+                ElementContext& elemCtx = *elementCtx_[ThreadManager::threadId()];
+                for (std::size_t i = begin; i < end; ++i) {
+                    elemCtx.updatePrimaryStencil(interiorElements_[i]);
+                    elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+                    const unsigned cell_idx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
+                    const auto& intQuants = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
+                    const auto& fs = intQuants.fluidState();
+
+                    const double pvValue = ebosProblem.referencePorosity(cell_idx, /*timeIdx=*/0) * ebosModel.dofTotalVolume( cell_idx );
+                    local.pvSum += pvValue;
+
+                    for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx)
+                    {
+                        if (!FluidSystem::phaseIsActive(phaseIdx)) {
+                            continue;
+                        }
 
-                const double pvValue = ebosProblem.referencePorosity(cell_idx, /*timeIdx=*/0) * ebosModel.dofTotalVolume( cell_idx );
-                pvSumLocal += pvValue;
+                        const unsigned compIdx = Indices::canonicalToActiveComponentIndex(FluidSystem::solventComponentIndex(phaseIdx));
 
-                for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx)
-                {
-                    if (!FluidSystem::phaseIsActive(phaseIdx)) {
-                        continue;
-                    }
+                        B_avg[ compIdx ] += 1.0 / fs.invB(phaseIdx).value();
+                        const auto R2 = ebosResid[cell_idx][compIdx];
 
-                    const unsigned compIdx = Indices::canonicalToActiveComponentIndex(FluidSystem::solventComponentIndex(phaseIdx));
+                        R_sum[ compIdx ] += R2;
+                        maxCoeff[ compIdx ] = std::max( maxCoeff[ compIdx ], std::abs( R2 ) / pvValue );
+                    }
 
-                    B_avg[ compIdx ] += 1.0 / fs.invB(phaseIdx).value();
-                    const auto R2 = ebosResid[cell_idx][compIdx];
+                    if constexpr (has_solvent_) {
+                        B_avg[ contiSolventEqIdx ] += 1.0 / intQuants.solventInverseFormationVolumeFactor().value();
+                        const auto R2 = ebosResid[cell_idx][contiSolventEqIdx];
+                        R_sum[ contiSolventEqIdx ] += R2;
+                        maxCoeff[ contiSolventEqIdx ] = std::max( maxCoeff[ contiSolventEqIdx ], std::abs( R2 ) / pvValue );
+                    }
+                    if constexpr (has_extbo_) {
+                        B_avg[ contiZfracEqIdx ] += 1.0 / fs.invB(FluidSystem::gasPhaseIdx).value();
+                        const auto R2 = ebosResid[cell_idx][contiZfracEqIdx];
+                        R_sum[ contiZfracEqIdx ] += R2;
+                        maxCoeff[ contiZfracEqIdx ] = std::max( maxCoeff[ contiZfracEqIdx ], std::abs( R2 ) / pvValue );
+                    }
+                    if constexpr (has_polymer_) {
+                        B_avg[ contiPolymerEqIdx ] += 1.0 / fs.invB(FluidSystem::waterPhaseIdx).value();
+                        const auto R2 = ebosResid[cell_idx][contiPolymerEqIdx];
+                        R_sum[ contiPolymerEqIdx ] += R2;
+                        maxCoeff[ contiPolymerEqIdx ] = std::max( maxCoeff[ contiPolymerEqIdx ], std::abs( R2 ) / pvValue );
+                    }
+                    if constexpr (has_foam_) {
+                        B_avg[ contiFoamEqIdx ] += 1.0 / fs.invB(FluidSystem::gasPhaseIdx).value();
+                        const auto R2 = ebosResid[cell_idx][contiFoamEqIdx];
+                        R_sum[ contiFoamEqIdx ] += R2;
+                        maxCoeff[ contiFoamEqIdx ] = std::max( maxCoeff[ contiFoamEqIdx ], std::abs( R2 ) / pvValue );
+                    }
+                    if constexpr (has_brine_) {
+                        B_avg[ contiBrineEqIdx ] += 1.0 / fs.invB(FluidSystem::waterPhaseIdx).value();
+                        const auto R2 = ebosResid[cell_idx][contiBrineEqIdx];
+                        R_sum[ contiBrineEqIdx ] += R2;
+                        maxCoeff[ contiBrineEqIdx ] = std::max( maxCoeff[ contiBrineEqIdx ], std::abs( R2 ) / pvValue );
+                    }
 
-                    R_sum[ compIdx ] += R2;
-                    maxCoeff[ compIdx ] = std::max( maxCoeff[ compIdx ], std::abs( R2 ) / pvValue );
-                }
+                    if constexpr (has_polymermw_) {
+                        static_assert(has_polymer_);
 
-                if constexpr (has_solvent_) {
-                    B_avg[ contiSolventEqIdx ] += 1.0 / intQuants.solventInverseFormationVolumeFactor().value();
-                    const auto R2 = ebosResid[cell_idx][contiSolventEqIdx];
-                    R_sum[ contiSolventEqIdx ] += R2;
-                    maxCoeff[ contiSolventEqIdx ] = std::max( maxCoeff[ contiSolventEqIdx ], std::abs( R2 ) / pvValue );
-                }
-                if constexpr (has_extbo_) {
-                    B_avg[ contiZfracEqIdx ] += 1.0 / fs.invB(FluidSystem::gasPhaseIdx).value();
-                    const auto R2 = ebosResid[cell_idx][contiZfracEqIdx];
-                    R_sum[ contiZfracEqIdx ] += R2;
-                    maxCoeff[ contiZfracEqIdx ] = std::max( maxCoeff[ contiZfracEqIdx ], std::abs( R2 ) / pvValue );
-                }
-                if constexpr (has_polymer_) {
-                    B_avg[ contiPolymerEqIdx ] += 1.0 / fs.invB(FluidSystem::waterPhaseIdx).value();
-                    const auto R2 = ebosResid[cell_idx][contiPolymerEqIdx];
-                    R_sum[ contiPolymerEqIdx ] += R2;
-                    maxCoeff[ contiPolymerEqIdx ] = std::max( maxCoeff[ contiPolymerEqIdx ], std::abs( R2 ) / pvValue );
-                }
-                if constexpr (has_foam_) {
-                    B_avg[ contiFoamEqIdx ] += 1.0 / fs.invB(FluidSystem::gasPhaseIdx).value();
-                    const auto R2 = ebosResid[cell_idx][contiFoamEqIdx];
-                    R_sum[ contiFoamEqIdx ] += R2;
-                    maxCoeff[ contiFoamEqIdx ] = std::max( maxCoeff[ contiFoamEqIdx ], std::abs( R2 ) / pvValue );
-                }
-                if constexpr (has_brine_) {
-                    B_avg[ contiBrineEqIdx ] += 1.0 / fs.invB(FluidSystem::waterPhaseIdx).value();
-                    const auto R2 = ebosResid[cell_idx][contiBrineEqIdx];
-                    R_sum[ contiBrineEqIdx ] += R2;
-                    maxCoeff[ contiBrineEqIdx ] = std::max( maxCoeff[ contiBrineEqIdx ], std::abs( R2 ) / pvValue );
-                }
+                        B_avg[contiPolymerMWEqIdx] += 1.0 / fs.invB(FluidSystem::waterPhaseIdx).value();
+                        // the residual of the polymer molecular equation is scaled down by a 100, since molecular weight
+                        // can be much bigger than 1, and this equation shares the same tolerance with other mass balance equations
+                        // TODO: there should be a more general way to determine the scaling-down coefficient
+                        const auto R2 = ebosResid[cell_idx][contiPolymerMWEqIdx] / 100.;
+                        R_sum[contiPolymerMWEqIdx] += R2;
+                        maxCoeff[contiPolymerMWEqIdx] = std::max( maxCoeff[contiPolymerMWEqIdx], std::abs( R2 ) / pvValue );
+                    }
 
-                if constexpr (has_polymermw_) {
-                    static_assert(has_polymer_);
-
-                    B_avg[contiPolymerMWEqIdx] += 1.0 / fs.invB(FluidSystem::waterPhaseIdx).value();
-                    // the residual of the polymer molecular equation is scaled down by a 100, since molecular weight
-                    // can be much bigger than 1, and this equation shares the same tolerance with other mass balance equations
-                    // TODO: there should be a more general way to determine the scaling-down coefficient
-                    const auto R2 = ebosResid[cell_idx][contiPolymerMWEqIdx] / 100.;
-                    R_sum[contiPolymerMWEqIdx] += R2;
-                    maxCoeff[contiPolymerMWEqIdx] = std::max( maxCoeff[contiPolymerMWEqIdx], std::abs( R2 ) / pvValue );
+                    if constexpr (has_energy_) {
+                        B_avg[ contiEnergyEqIdx ] += 1.0;
+                        const auto R2 = ebosResid[cell_idx][contiEnergyEqIdx];
+                        R_sum[ contiEnergyEqIdx ] += R2;
+                        maxCoeff[ contiEnergyEqIdx ] = std::max( maxCoeff[ contiEnergyEqIdx ], std::abs( R2 ) / pvValue );
+                    }
                 }
+            });
 
-                if constexpr (has_energy_) {
-                    B_avg[ contiEnergyEqIdx ] += 1.0;
-                    const auto R2 = ebosResid[cell_idx][contiEnergyEqIdx];
-                    R_sum[ contiEnergyEqIdx ] += R2;
-                    maxCoeff[ contiEnergyEqIdx ] = std::max( maxCoeff[ contiEnergyEqIdx ], std::abs( R2 ) / pvValue );
+            // combine the chunks in a fixed order, such that the result does
+            // not depend on the number of threads
+            double pvSumLocal = 0.0;
+            for (const auto& partial : partials) {
+                pvSumLocal += partial.pvSum;
+                for (int compIdx = 0; compIdx < numEq; ++compIdx) {
+                    R_sum[compIdx] += partial.R_sum[compIdx];
+                    B_avg[compIdx] += partial.B_avg[compIdx];
+                    maxCoeff[compIdx] = std::max(maxCoeff[compIdx], partial.maxCoeff[compIdx]);
                 }
-
             }
 
             // compute local average in terms of global number of elements
@@ -732,34 +789,37 @@ namespace Opm {
 
         double computeCnvErrorPv(const std::vector<Scalar>& B_avg, double dt)
         {
-            double errorPV{};
             const auto& ebosModel = ebosSimulator_.model();
             const auto& ebosProblem = ebosSimulator_.problem();
             const auto& ebosResid = ebosSimulator_.model().linearizer().residual();
-            const auto& gridView = ebosSimulator().gridView();
-            ElementContext elemCtx(ebosSimulator_);
+            const auto& elemMapper = ebosModel.elementMapper();
 
-            for (const auto& elem: elements(gridView, Dune::Partitions::interiorBorder))
+            const auto partials = chunkedReduce_(interiorBorderElements_.size(), 0.0,
+                [&, this](std::size_t begin, std::size_t end, double& errorPV)
             {
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-                const unsigned cell_idx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const double pvValue = ebosProblem.referencePorosity(cell_idx, /*timeIdx=*/0) * ebosModel.dofTotalVolume( cell_idx );
-                const auto& cellResidual = ebosResid[cell_idx];
-                bool cnvViolated = false;
-
-                for (unsigned eqIdx = 0; eqIdx < cellResidual.size(); ++eqIdx)
-                {
-                    using std::abs;
-                    Scalar CNV = cellResidual[eqIdx] * dt * B_avg[eqIdx] / pvValue;
-                    cnvViolated = cnvViolated || (abs(CNV) > param_.tolerance_cnv_);
-                }
+                for (std::size_t i = begin; i < end; ++i) {
+                    const unsigned cell_idx = elemMapper.index(interiorBorderElements_[i]);
+                    const double pvValue = ebosProblem.referencePorosity(cell_idx, /*timeIdx=*/0) * ebosModel.dofTotalVolume( cell_idx );
+                    const auto& cellResidual = ebosResid[cell_idx];
+                    bool cnvViolated = false;
 
-                if (cnvViolated)
-                {
-                    errorPV += pvValue;
+                    for (unsigned eqIdx = 0; eqIdx < cellResidual.size(); ++eqIdx)
+                    {
+                        using std::abs;
+                        Scalar CNV = cellResidual[eqIdx] * dt * B_avg[eqIdx] / pvValue;
+                        cnvViolated = cnvViolated || (abs(CNV) > param_.tolerance_cnv_);
+                    }
+
+                    if (cnvViolated)
+                    {
+                        errorPV += pvValue;
+                    }
                 }
-            }
+            });
+
+            double errorPV{};
+            for (const double partial : partials)
+                errorPV += partial;
 
             return grid_.comm().sum(errorPV);
         }
@@ -951,6 +1011,15 @@ namespace Opm {
         Simulator& ebosSimulator()
         { return ebosSimulator_; }
 
+        /// CNV residuals by phase of each nonlinear iteration in the current time step.
+        const std::vector<std::vector<double>>& residualNormsHistory() const
+        { return residual_norms_history_; }
+
+        /// Number of consecutive nonlinear iterations in the current time step
+        /// for which the linear solver did not converge.
+        int linearSolveFailuresInStep() const
+        { return linear_solve_failures_; }
+
         /// return the statistics if the nonlinearIteration() method failed
         const SimulatorReportSingle& failureReport() const
         { return failureReport_; }
@@ -993,6 +1062,7 @@ namespace Opm {
         long int global_nc_;
 
         std::vector<std::vector<double>> residual_norms_history_;
+        int linear_solve_failures_ = 0;
         double current_relaxation_;
         BVector dx_old_;
 
@@ -1016,6 +1086,35 @@ namespace Opm {
         }
 
     private:
+        // Number of elements processed by a single task of chunkedReduce_().
+        static constexpr std::size_t elementChunkSize_ = 1024;
+
+        // Reduces the index range [0, numElements) in parallel. The range is
+        // split into chunks of a fixed size, body(begin, end, partial) is
+        // called for each chunk and the partial result of every chunk is
+        // returned in order. Since the chunks do not depend on the number of
+        // threads, neither does the result of combining them in order.
+        template <class Partial, class Body>
+        static std::vector<Partial> chunkedReduce_(std::size_t numElements,
+                                                   const Partial& init,
+                                                   const Body& body)
+        {
+            const int numChunks = static_cast<int>((numElements + elementChunkSize_ - 1) / elementChunkSize_);
+            std::vector<Partial> partials(numChunks, init);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int chunk = 0; chunk < numChunks; ++chunk) {
+                const std::size_t begin = chunk * elementChunkSize_;
+                const std::size_t end = std::min(numElements, begin + elementChunkSize_);
+                body(begin, end, partials[chunk]);
+            }
+            return partials;
+        }
+
+        std::vector<Element> interiorElements_;
+        std::vector<Element> interiorBorderElements_;
+        std::vector<std::unique_ptr<ElementContext>> elementCtx_;
 
         double dpMaxRel() const { return param_.dp_max_rel_; }
         double dsMax() const { return param_.ds_max_; }
@@ -92,6 +92,14 @@ struct SolveWelleqInitially {
     using type = UndefinedProperty;
 };
 template<class TypeTag, class MyTypeTag>
+struct WellPotentialReuseTolerance {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
+struct GasLiftCurveTolerance {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
 struct UpdateEquationsScaling {
     using type = UndefinedProperty;
 };
@@ -221,6 +229,16 @@ struct SolveWelleqInitially<TypeTag, TTag::FlowModelParameters> {
     static constexpr bool value = true;
 };
 template<class TypeTag>
+struct WellPotentialReuseTolerance<TypeTag, TTag::FlowModelParameters> {
+    using type = GetPropType<TypeTag, Scalar>;
+    static constexpr type value = 0.0;
+};
+template<class TypeTag>
+struct GasLiftCurveTolerance<TypeTag, TTag::FlowModelParameters> {
+    using type = GetPropType<TypeTag, Scalar>;
+    static constexpr type value = 0.0;
+};
+template<class TypeTag>
 struct UpdateEquationsScaling<TypeTag, TTag::FlowModelParameters> {
     static constexpr bool value = false;
 };
@@ -368,6 +386,15 @@ namespace Opm
         /// Solve well equation initially
         bool solve_welleq_initially_;
 
+        /// Relative change of the pressures and saturations of the connection cells
+        /// below which the previously computed potentials of a well are reused
+        double well_potential_reuse_tolerance_;
+
+        /// Relative change of the connection cell states below which the rates
+        /// of a well computed during gas lift optimization are reused, negative
+        /// to disable the reuse
+        double glift_curve_tolerance_;
+
         /// Update scaling factors for mass balance equations
         bool update_equations_scaling_;
 
@@ -414,6 +441,8 @@ namespace Opm
             maxSinglePrecisionTimeStep_ = EWOMS_GET_PARAM(TypeTag, Scalar, MaxSinglePrecisionDays) *24*60*60;
             max_strict_iter_ = EWOMS_GET_PARAM(TypeTag, int, MaxStrictIter);
             solve_welleq_initially_ = EWOMS_GET_PARAM(TypeTag, bool, SolveWelleqInitially);
+            well_potential_reuse_tolerance_ = EWOMS_GET_PARAM(TypeTag, Scalar, WellPotentialReuseTolerance);
+            glift_curve_tolerance_ = EWOMS_GET_PARAM(TypeTag, Scalar, GasLiftCurveTolerance);
             update_equations_scaling_ = EWOMS_GET_PARAM(TypeTag, bool, UpdateEquationsScaling);
             use_update_stabilization_ = EWOMS_GET_PARAM(TypeTag, bool, UseUpdateStabilization);
             matrix_add_well_contributions_ = EWOMS_GET_PARAM(TypeTag, bool, MatrixAddWellContributions);
@@ -449,6 +478,8 @@ namespace Opm
             EWOMS_REGISTER_PARAM(TypeTag, Scalar, MaxSinglePrecisionDays, "Maximum time step size where single precision floating point arithmetic can be used solving for the linear systems of equations");
             EWOMS_REGISTER_PARAM(TypeTag, int, MaxStrictIter, "Maximum number of Newton iterations before relaxed tolerances are used for the CNV convergence criterion");
             EWOMS_REGISTER_PARAM(TypeTag, bool, SolveWelleqInitially, "Fully solve the well equations before each iteration of the reservoir model");
+            EWOMS_REGISTER_PARAM(TypeTag, Scalar, WellPotentialReuseTolerance, "Reuse the potentials of a well as long as its controls are unchanged and the states of its connection cells, its connection pressure drops and its rates change by less than this relative tolerance. With the default of zero, potentials are only reused if none of these changed");
+            EWOMS_REGISTER_PARAM(TypeTag, Scalar, GasLiftCurveTolerance, "Reuse the rates of a well at a given lift gas rate computed during gas lift optimization as long as its controls are unchanged and the pressures, mobilities and formation volume factors of its connection cells change by less than this relative tolerance. A negative value disables the reuse");
             EWOMS_REGISTER_PARAM(TypeTag, bool, UpdateEquationsScaling, "Update scaling factors for mass balance equations during the run");
             EWOMS_REGISTER_PARAM(TypeTag, bool, UseUpdateStabilization, "Try to detect and correct oscillations or stagnation during the Newton method");
             EWOMS_REGISTER_PARAM(TypeTag, bool, MatrixAddWellContributions, "Explicitly specify the influences of wells between cells in the Jacobian and preconditioner matrices");
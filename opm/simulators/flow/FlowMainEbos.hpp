@@ -25,10 +25,12 @@
 
 #include <sys/utsname.h>
 
+
 #include <opm/simulators/flow/SimulatorFullyImplicitBlackoilEbos.hpp>
 #include <opm/simulators/utils/ParallelFileMerger.hpp>
 #include <opm/simulators/utils/moduleVersion.hpp>
 #include <opm/simulators/utils/ParallelEclipseState.hpp>
+#include <opm/simulators/utils/PerformanceTrace.hpp>
 
 #include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/parser/eclipse/EclipseState/IOConfig/IOConfig.hpp>
@@ -57,6 +59,10 @@ template<class TypeTag, class MyTypeTag>
 struct EnableLoggingFalloutWarning {
     using type = UndefinedProperty;
 };
+template<class TypeTag, class MyTypeTag>
+struct EnablePerformanceTrace {
+    using type = UndefinedProperty;
+};
 
 // TODO: enumeration parameters. we use strings for now.
 template<class TypeTag>
@@ -72,6 +78,10 @@ template<class TypeTag>
 struct OutputInterval<TypeTag, TTag::EclFlowProblem> {
     static constexpr int value = 1;
 };
+template<class TypeTag>
+struct EnablePerformanceTrace<TypeTag, TTag::EclFlowProblem> {
+    static constexpr bool value = true;
+};
 
 } // namespace Opm::Properties
 
@@ -123,6 +133,10 @@ namespace Opm
                                  "Specify the number of report steps between two consecutive writes of restart data");
             EWOMS_REGISTER_PARAM(TypeTag, bool, EnableLoggingFalloutWarning,
                                  "Developer option to see whether logging was on non-root processors. In that case it will be appended to the *.DBG or *.PRT files");
+#if OPM_ENABLE_PERFORMANCE_TRACE
+            EWOMS_REGISTER_PARAM(TypeTag, bool, EnablePerformanceTrace,
+                                 "Record the scoped timers and counters and write a trace file per process and an imbalance summary at the end of the run");
+#endif
 
             Simulator::registerParameters();
 
@@ -462,6 +476,10 @@ namespace Opm
 
             using ThreadManager = GetPropType<TypeTag, Properties::ThreadManager>;
             ThreadManager::init();
+
+#if OPM_ENABLE_PERFORMANCE_TRACE
+            PerformanceTrace::setEnabled(EWOMS_GET_PARAM(TypeTag, bool, EnablePerformanceTrace));
+#endif
         }
 
 
@@ -596,8 +614,73 @@ namespace Opm
                     report.fullReports(os);
                 }
             }
+            if (mpi_size_ > 1 && ebosSimulator_->vanguard().costBasedPartitioning()) {
+                writeCellCosts_(report);
+            }
+#if OPM_ENABLE_PERFORMANCE_TRACE
+            if (PerformanceTrace::enabled()) {
+                writePerformanceTrace_();
+            }
+#endif
+        }
+
+        // Estimate the cost of each cell from the measured times of this
+        // process, for the cost based partitioning of later runs of the
+        // same case. The assembly time of each well goes to its perforated
+        // cells, the remaining assembly and the preconditioner setup time
+        // are distributed in proportion to the number of blocks of each
+        // cell's Jacobian row, which is the work done per cell there.
+        void writeCellCosts_(const SimulatorReport& report)
+        {
+            const auto& vanguard = ebosSimulator_->vanguard();
+            const auto& wellTimes = ebosSimulator_->problem().wellModel().wellAssembleTimePerCell();
+            const auto& jacobian = ebosSimulator_->model().linearizer().jacobian().istlMatrix();
+
+            double reservoirTime = 0.0;
+            for (const auto* part : {&report.success, &report.failure}) {
+                // the assembly time includes the time spent on the wells
+                reservoirTime += part->assemble_time - part->assemble_time_well
+                    + part->linear_solve_setup_time;
+            }
+            const double timePerBlock = jacobian.nonzeroes() > 0
+                ? reservoirTime / jacobian.nonzeroes() : 0.0;
+
+            std::vector<double> costs(vanguard.gridView().size(/*codim=*/0), 0.0);
+            for (std::size_t cellIdx = 0; cellIdx < costs.size(); ++cellIdx) {
+                if (cellIdx < jacobian.N()) {
+                    costs[cellIdx] = timePerBlock * jacobian[cellIdx].size();
+                }
+                if (cellIdx < wellTimes.size()) {
+                    costs[cellIdx] += wellTimes[cellIdx];
+                }
+            }
+
+            namespace fs = ::Opm::filesystem;
+            const fs::path output_dir(eclState().getIOConfig().getOutputDir());
+            const std::string filename = eclState().getIOConfig().getBaseName() + ".CELLCOST";
+            vanguard.writeCellCosts(costs, (output_dir / filename).string());
         }
 
+#if OPM_ENABLE_PERFORMANCE_TRACE
+        // Every rank writes its own trace file, the imbalance summary is
+        // a collective operation and is only logged on the I/O rank.
+        void writePerformanceTrace_()
+        {
+            const auto& trace = PerformanceTrace::instance();
+            namespace fs = ::Opm::filesystem;
+            const fs::path output_dir(eclState().getIOConfig().getOutputDir());
+            const std::string filename = eclState().getIOConfig().getBaseName()
+                + fmt::format(".TRACE.{}.json", mpi_rank_);
+            trace.writeChromeTrace((output_dir / filename).string(), mpi_rank_);
+
+            const std::string summary =
+                trace.imbalanceSummary(Dune::MPIHelper::getCollectiveCommunication());
+            if (this->output_cout_) {
+                OpmLog::info(summary);
+            }
+        }
+#endif
+
         // Run the simulator.
         int runSimulatorInitOrRun_(int (FlowMainEbos::* initOrRunFunc)())
         {
@@ -46,6 +46,8 @@
 #include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/parser/eclipse/EclipseState/checkDeck.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/ArrayDimChecker.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 
 #include <opm/models/utils/propertysystem.hh>
 #include <opm/models/utils/parametersystem.hh>
@@ -61,8 +63,11 @@
 
 #if HAVE_MPI
 #include <opm/simulators/utils/ParallelEclipseState.hpp>
+#include <mpi.h>
 #endif
 
+#include <cstdlib>
+#include <memory>
 #include <string>
 #include <type_traits>
 
@@ -89,6 +94,74 @@ namespace Opm {
     Vanguard::setExternalSummaryConfig(std::move(summaryConfig));
   }
 
+  // The number of OpenMP threads per process explicitly requested by
+  // --threads-per-process, or 1 if it is not given. Needed before MPI is
+  // initialized and thus before the parameters are parsed, so the option
+  // is looked up in the command line directly.
+  inline int requestedThreadsPerProcess([[maybe_unused]] int argc,
+                                        [[maybe_unused]] char** argv)
+  {
+#ifdef _OPENMP
+    const std::string option = "--threads-per-process";
+    for (int i = 1; i < argc; ++i) {
+      const std::string arg = argv[i];
+      std::string value;
+      if (arg.compare(0, option.size() + 1, option + "=") == 0)
+        value = arg.substr(option.size() + 1);
+      else if (arg == option && i + 1 < argc)
+        value = argv[i + 1];
+      else
+        continue;
+
+      const int threads = std::atoi(value.c_str());
+      if (threads > 0)
+        return threads;
+    }
+#endif
+    return 1;
+  }
+
+  // The well computations of a process are done by several OpenMP threads,
+  // which call into MPI concurrently on the communicators of the wells,
+  // only if MPI provides full thread support. As that has a cost on several
+  // MPI implementations, it is only requested if more than one thread per
+  // process is asked for explicitly with --threads-per-process. MPI is then
+  // initialized before Dune takes over the existing initialization.
+  // Otherwise Dune::MPIHelper initializes MPI as usual and the well loops
+  // stay serial.
+  //
+  // Dune::MPIHelper only finalizes MPI it initialized itself. The guard
+  // below is created before the MPIHelper singleton and hence destroyed
+  // right after it, finalizing MPI at the point MPIHelper would have.
+  inline void initMPIThreadMultiple([[maybe_unused]] int& argc,
+                                    [[maybe_unused]] char**& argv)
+  {
+#if HAVE_MPI && defined(_OPENMP)
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    if (initialized || requestedThreadsPerProcess(argc, argv) <= 1)
+      return;
+
+    struct FinalizeGuard
+    {
+      FinalizeGuard(int& argc, char**& argv)
+      {
+        int provided = MPI_THREAD_SINGLE;
+        MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+      }
+
+      ~FinalizeGuard()
+      {
+        int finalized = 0;
+        MPI_Finalized(&finalized);
+        if (!finalized)
+          MPI_Finalize();
+      }
+    };
+    static FinalizeGuard guard(argc, argv);
+#endif
+  }
+
 // ----------------- Main program -----------------
   template <class TypeTag>
   int flowEbosMain(int argc, char** argv, bool outputCout, bool outputFiles)
@@ -97,6 +170,7 @@ namespace Opm {
     // with incorrect locale settings.
     resetLocale();
 
+    initMPIThreadMultiple(argc, argv);
 # if HAVE_DUNE_FEM
     Dune::Fem::MPIManager::initialize(argc, argv);
 # else
@@ -151,6 +225,23 @@ namespace Opm
         {
         }
 
+        // Construct from input which has already been parsed, e.g. the
+        // shared base case of an ensemble. The simulator works on private
+        // copies so the shared objects can be reused by every realization
+        // without parsing the deck again.
+        Main(const std::string &filename,
+             std::shared_ptr<const Deck> deck,
+             std::shared_ptr<const EclipseState> eclipseState,
+             std::shared_ptr<const Schedule> schedule,
+             std::shared_ptr<const SummaryConfig> summaryConfig)
+            : Main(filename)
+        {
+            deck_ = std::make_unique<Deck>(*deck);
+            eclipseState_ = std::make_unique<EclipseState>(*eclipseState);
+            schedule_ = std::make_unique<Schedule>(*schedule);
+            summaryConfig_ = std::make_unique<SummaryConfig>(*summaryConfig);
+        }
+
         int runDynamic()
         {
             int exitCode = EXIT_SUCCESS;
@@ -357,6 +448,7 @@ namespace Opm
 
             handleVersionCmdLine_(argc_, argv_);
             // MPI setup.
+            initMPIThreadMultiple(argc_, argv_);
 #if HAVE_DUNE_FEM
             Dune::Fem::MPIManager::initialize(argc_, argv_);
             int mpiRank = Dune::Fem::MPIManager::rank();
@@ -463,7 +555,8 @@ namespace Opm
 
                 readDeck(mpiRank, deckFilename, deck_, eclipseState_, schedule_,
                          summaryConfig_, nullptr, python, std::move(parseContext),
-                         init_from_restart_file, outputCout_, outputInterval);
+                         init_from_restart_file, outputCout_, outputInterval,
+                         EWOMS_GET_PARAM(PreTypeTag, std::string, EclParsedStateCacheDir));
 
                 setupTime_ = externalSetupTimer.elapsed();
                 outputFiles_ = (outputMode != FileOutputMode::OUTPUT_NONE);
@@ -33,7 +33,12 @@
 
 #include <dune/common/fmatrix.hh>
 #include <dune/istl/bcrsmatrix.hh>
+
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace Opm::Properties {
 
@@ -57,6 +62,18 @@ template<class TypeTag, class MyTypeTag>
 struct NewtonRelaxationType{
     using type = UndefinedProperty;
 };
+template<class TypeTag, class MyTypeTag>
+struct NewtonDivergenceIterations {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
+struct NewtonDivergenceFactor {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
+struct NewtonStagnationTolerance {
+    using type = UndefinedProperty;
+};
 
 template<class TypeTag>
 struct NewtonMaxRelax<TypeTag, TTag::FlowNonLinearSolver> {
@@ -75,6 +92,20 @@ template<class TypeTag>
 struct NewtonRelaxationType<TypeTag, TTag::FlowNonLinearSolver> {
     static constexpr auto value = "dampen";
 };
+template<class TypeTag>
+struct NewtonDivergenceIterations<TypeTag, TTag::FlowNonLinearSolver> {
+    static constexpr int value = 0;
+};
+template<class TypeTag>
+struct NewtonDivergenceFactor<TypeTag, TTag::FlowNonLinearSolver> {
+    using type = GetPropType<TypeTag, Scalar>;
+    static constexpr type value = 10.0;
+};
+template<class TypeTag>
+struct NewtonStagnationTolerance<TypeTag, TTag::FlowNonLinearSolver> {
+    using type = GetPropType<TypeTag, Scalar>;
+    static constexpr type value = 1.0e-3;
+};
 
 } // namespace Opm::Properties
 
@@ -105,6 +136,9 @@ class WellState;
             double relaxRelTol_;
             int maxIter_; // max nonlinear iterations
             int minIter_; // min nonlinear iterations
+            int divergenceIter_; // iterations to look back for divergence, zero disables the check
+            double divergenceFactor_;
+            double stagnationTol_;
 
             SolverParameters()
             {
@@ -115,6 +149,9 @@ class WellState;
                 relaxMax_ = EWOMS_GET_PARAM(TypeTag, Scalar, NewtonMaxRelax);
                 maxIter_ = EWOMS_GET_PARAM(TypeTag, int, FlowNewtonMaxIterations);
                 minIter_ = EWOMS_GET_PARAM(TypeTag, int, FlowNewtonMinIterations);
+                divergenceIter_ = EWOMS_GET_PARAM(TypeTag, int, NewtonDivergenceIterations);
+                divergenceFactor_ = EWOMS_GET_PARAM(TypeTag, Scalar, NewtonDivergenceFactor);
+                stagnationTol_ = EWOMS_GET_PARAM(TypeTag, Scalar, NewtonStagnationTolerance);
 
                 const auto& relaxationTypeString = EWOMS_GET_PARAM(TypeTag, std::string, NewtonRelaxationType);
                 if (relaxationTypeString == "dampen") {
@@ -132,6 +169,9 @@ class WellState;
                 EWOMS_REGISTER_PARAM(TypeTag, int, FlowNewtonMaxIterations, "The maximum number of Newton iterations per time step used by flow");
                 EWOMS_REGISTER_PARAM(TypeTag, int, FlowNewtonMinIterations, "The minimum number of Newton iterations per time step used by flow");
                 EWOMS_REGISTER_PARAM(TypeTag, std::string, NewtonRelaxationType, "The type of relaxation used by flow's Newton method");
+                EWOMS_REGISTER_PARAM(TypeTag, int, NewtonDivergenceIterations, "Abort a time step early if the residual grows, stagnates or the linear solver fails for this many consecutive Newton iterations (0 disables the check)");
+                EWOMS_REGISTER_PARAM(TypeTag, Scalar, NewtonDivergenceFactor, "Growth of the residual relative to the best iterate of the time step that is considered divergence");
+                EWOMS_REGISTER_PARAM(TypeTag, Scalar, NewtonStagnationTolerance, "Relative change of the residual per Newton iteration below which the iterations are considered stagnant");
             }
 
             void reset()
@@ -143,6 +183,9 @@ class WellState;
                 relaxRelTol_ = 0.2;
                 maxIter_ = 10;
                 minIter_ = 1;
+                divergenceIter_ = 0;
+                divergenceFactor_ = 10.0;
+                stagnationTol_ = 1.0e-3;
             }
 
         };
@@ -214,6 +257,21 @@ class WellState;
                     failureReport_ += model_->failureReport();
                     throw;
                 }
+
+                // Give up on the time step as soon as the iterations are
+                // clearly going nowhere instead of exhausting maxIter(). The
+                // caller restores the state of the previous time level and
+                // retries with a smaller step.
+                if (!converged && iteration > minIter() && iteration <= maxIter() &&
+                    detectDivergence(model_->residualNormsHistory(),
+                                     model_->linearSolveFailuresInStep()))
+                {
+                    failureReport_ = report;
+
+                    std::string msg = "Solver convergence failure - Newton iterations diverging or stagnating after "
+                        + std::to_string(iteration) + " iterations.";
+                    OPM_THROW_NOLOG(NumericalIssue, msg);
+                }
             }
             while ( (!converged && (iteration <= maxIter())) || (iteration <= minIter()));
 
@@ -309,6 +367,58 @@ class WellState;
         }
 
 
+        /// Detect whether the Newton process of the current time step is diverging
+        /// or stagnating.
+        ///
+        /// The check looks at the largest CNV residual of the last
+        /// divergenceIterations() iterations: The process is considered
+        /// divergent if the residual grew in each of them and ended up more
+        /// than divergenceFactor() times above the best earlier iterate, and
+        /// stagnant if it changed by less than stagnationTolerance() each
+        /// time. The same number of consecutive linear solver failures also
+        /// counts as divergence.
+        bool detectDivergence(const std::vector<std::vector<double>>& residualHistory,
+                              const int linearSolveFailures) const
+        {
+            const int window = divergenceIterations();
+            const int it = static_cast<int>(residualHistory.size()) - 1;
+            if (window <= 0) {
+                return false;
+            }
+            if (linearSolveFailures >= window) {
+                return true;
+            }
+            if (it < window) {
+                return false;
+            }
+
+            const auto maxNorm = [](const std::vector<double>& norms)
+            {
+                double result = 0.0;
+                for (const double norm : norms) {
+                    result = std::max(result, std::abs(norm));
+                }
+                return result;
+            };
+
+            double best = maxNorm(residualHistory[0]);
+            for (int i = 1; i <= it - window; ++i) {
+                best = std::min(best, maxNorm(residualHistory[i]));
+            }
+
+            bool growing = true;
+            bool stagnant = true;
+            for (int i = it - window + 1; i <= it; ++i) {
+                const double previous = maxNorm(residualHistory[i - 1]);
+                const double current = maxNorm(residualHistory[i]);
+                growing = growing && (current > previous);
+                stagnant = stagnant && (std::abs(current - previous) <= stagnationTolerance() * previous);
+            }
+
+            const bool diverged = growing && (maxNorm(residualHistory[it]) > divergenceFactor() * best);
+            return diverged || stagnant;
+        }
+
         /// Apply a stabilization to dx, depending on dxOld and relaxation parameters.
         /// Implemention for Dune block vectors.
         template <class BVector>
@@ -374,6 +484,18 @@ class WellState;
         int minIter() const
         { return param_.minIter_; }
 
+        /// The number of iterations considered when detecting divergence, zero if disabled.
+        int divergenceIterations() const
+        { return param_.divergenceIter_; }
+
+        /// The residual growth relative to the best iterate considered as divergence.
+        double divergenceFactor() const
+        { return param_.divergenceFactor_; }
+
+        /// The relative residual change below which iterations are considered stagnant.
+        double stagnationTolerance() const
+        { return param_.stagnationTol_; }
+
         /// Set parameters to override those given at construction time.
         void setParameters(const SolverParameters& param)
         { param_ = param; }
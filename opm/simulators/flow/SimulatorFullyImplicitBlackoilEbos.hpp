@@ -28,11 +28,18 @@
 #include <opm/simulators/wells/WellState.hpp>
 #include <opm/simulators/aquifers/BlackoilAquiferModel.hpp>
 #include <opm/simulators/utils/moduleVersion.hpp>
+#include <opm/simulators/utils/SimulatorCheckpoint.hpp>
 #include <opm/simulators/timestepping/AdaptiveTimeSteppingEbos.hpp>
 #include <opm/grid/utility/StopWatch.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
 
+#include <ebos/eclmpiserializer.hh>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
 namespace Opm::Properties {
 
 template<class TypeTag, class MyTypeTag>
@@ -43,6 +50,14 @@ template<class TypeTag, class MyTypeTag>
 struct EnableTuning {
     using type = UndefinedProperty;
 };
+template<class TypeTag, class MyTypeTag>
+struct CheckpointInterval {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
+struct RestartFromCheckpoint {
+    using type = UndefinedProperty;
+};
 
 template<class TypeTag>
 struct EnableTerminalOutput<TypeTag, TTag::EclFlowProblem> {
@@ -56,6 +71,14 @@ template<class TypeTag>
 struct EnableTuning<TypeTag, TTag::EclFlowProblem> {
     static constexpr bool value = false;
 };
+template<class TypeTag>
+struct CheckpointInterval<TypeTag, TTag::EclFlowProblem> {
+    static constexpr int value = 0;
+};
+template<class TypeTag>
+struct RestartFromCheckpoint<TypeTag, TTag::EclFlowProblem> {
+    static constexpr bool value = false;
+};
 
 } // namespace Opm::Properties
 
@@ -136,6 +159,12 @@ public:
                              "Use adaptive time stepping between report steps");
         EWOMS_REGISTER_PARAM(TypeTag, bool, EnableTuning,
                              "Honor some aspects of the TUNING keyword.");
+        EWOMS_REGISTER_PARAM(TypeTag, int, CheckpointInterval,
+                             "Write a binary checkpoint of the simulator state every this many report steps. "
+                             "Zero disables checkpointing");
+        EWOMS_REGISTER_PARAM(TypeTag, bool, RestartFromCheckpoint,
+                             "Continue the simulation from the checkpoint written by a previous run "
+                             "of the case on the same number of processes");
     }
 
     /// Run the simulation.
@@ -183,6 +212,32 @@ public:
                 adaptiveTimeStepping_->setSuggestedNextStep(ebosSimulator_.timeStepSize());
             }
         }
+
+        checkpointInterval_ = EWOMS_GET_PARAM(TypeTag, int, CheckpointInterval);
+        const bool restartFromCheckpoint = EWOMS_GET_PARAM(TypeTag, bool, RestartFromCheckpoint);
+        if (checkpointInterval_ > 0 || restartFromCheckpoint) {
+            const auto unsupported = SimulatorCheckpoint::unsupportedKeywords(schedule());
+            if (!unsupported.empty()) {
+                OPM_THROW(std::runtime_error, "Checkpointing is not supported for decks using "
+                          + unsupported + ", their dynamic state is not part of the checkpoint. "
+                          "Remove CheckpointInterval and RestartFromCheckpoint");
+            }
+#if HAVE_MPI
+            const auto& comm = grid().comm();
+            const auto& ioConfig = eclState().getIOConfig();
+            checkpoint_ = std::make_unique<SimulatorCheckpoint>(ioConfig.getOutputDir(),
+                                                                ioConfig.getBaseName(),
+                                                                comm.rank(), comm.size(),
+                                                                EWOMS_GET_PARAM(TypeTag, bool, EnableAsyncEclOutput));
+            if (restartFromCheckpoint) {
+                loadCheckpoint_(timer);
+            }
+#else
+            OpmLog::warning("Checkpointing requires MPI support, "
+                            "CheckpointInterval and RestartFromCheckpoint are ignored");
+            checkpointInterval_ = 0;
+#endif
+        }
     }
 
     bool runStep(SimulatorTimer& timer)
@@ -282,6 +337,25 @@ public:
         // Increment timer, remember well state.
         ++timer;
 
+        if (checkpoint_ && checkpointInterval_ > 0 && !timer.done() &&
+            timer.currentStepNum() % checkpointInterval_ == 0) {
+            // Wells shut by economic limits or convergence failures stay
+            // shut, which the checkpoint cannot represent. The last
+            // checkpoint written before is kept.
+            if (wellModel_().hasClosedWellsOrCompletions()) {
+                OpmLog::error("Wells or completions have been shut, their state is not part of "
+                              "the checkpoint. No further checkpoints are written, the last one "
+                              "remains in '" + checkpoint_->fileName() + "'");
+                checkpointInterval_ = 0;
+            }
+            else {
+                Dune::Timer checkpointTimer;
+                checkpointTimer.start();
+                writeCheckpoint_(timer);
+                report_.success.output_write_time += checkpointTimer.stop();
+            }
+        }
+
         if (terminalOutput_) {
             if (!timer.initialStep()) {
                 const std::string version = moduleVersionName();
@@ -306,6 +380,9 @@ public:
             finalOutputTimer.start();
 
             ebosSimulator_.problem().finalizeOutput();
+            if (checkpoint_) {
+                checkpoint_->wait();
+            }
             report_.success.output_write_time += finalOutputTimer.stop();
         }
 
@@ -320,7 +397,116 @@ public:
     const Grid& grid() const
     { return ebosSimulator_.vanguard().grid(); }
 
+    /// The complete state needed to continue the simulation at the start of
+    /// a report step: the primary variables, the history dependent state of
+    /// the problem, wells, aquifers and tracers, the time stepping state and
+    /// the summary state holding the cumulative quantities.
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        auto& model = ebosSimulator_.model();
+        auto& solution = model.solution(/*timeIdx=*/0);
+        constexpr unsigned numEq = PrimaryVariables::numEq;
+
+        std::vector<double> values;
+        std::vector<int> meanings;
+        if (serializer.isSerializing()) {
+            values.reserve(numEq * solution.size());
+            meanings.reserve(solution.size());
+            for (const auto& priVars : solution) {
+                for (unsigned eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+                    values.push_back(priVars[eqIdx]);
+                }
+                meanings.push_back(static_cast<int>(priVars.primaryVarsMeaning()));
+            }
+        }
+        serializer(values);
+        serializer(meanings);
+        if (!serializer.isSerializing()) {
+            if (meanings.size() != solution.size() || values.size() != numEq * solution.size()) {
+                throw std::runtime_error("The checkpoint does not match the grid of this run");
+            }
+            for (std::size_t dofIdx = 0; dofIdx < solution.size(); ++dofIdx) {
+                auto& priVars = solution[dofIdx];
+                for (unsigned eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+                    priVars[eqIdx] = values[numEq*dofIdx + eqIdx];
+                }
+                using Meaning = typename PrimaryVariables::PrimaryVarsMeaning;
+                priVars.setPrimaryVarsMeaning(static_cast<Meaning>(meanings[dofIdx]));
+            }
+            model.solution(/*timeIdx=*/1) = solution;
+            model.invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
+        }
+
+        ebosSimulator_.problem().serializeOp(serializer);
+
+        double nextStep = adaptiveTimeStepping_ ? adaptiveTimeStepping_->suggestedNextStep() : -1.0;
+        serializer(nextStep);
+        if (!serializer.isSerializing() && adaptiveTimeStepping_) {
+            adaptiveTimeStepping_->setSuggestedNextStep(nextStep);
+        }
+
+        auto& summaryState = ebosSimulator_.vanguard().summaryState();
+        std::vector<char> summaryBuffer;
+        if (serializer.isSerializing()) {
+            summaryBuffer = summaryState.serialize();
+        }
+        serializer(summaryBuffer);
+        if (!serializer.isSerializing()) {
+            summaryState.deserialize(summaryBuffer);
+        }
+    }
+
 protected:
+    void writeCheckpoint_(const SimulatorTimer& timer)
+    {
+        EclMpiSerializer ser(grid().comm());
+        ser.pack(*this);
+        std::vector<char> buffer = ser.buffer();
+        buffer.resize(ser.position());
+        checkpoint_->write(timer.currentStepNum(), std::move(buffer));
+    }
+
+    void loadCheckpoint_(SimulatorTimer& timer)
+    {
+        const auto& comm = grid().comm();
+
+        // every process needs its own file, fail collectively if one is missing
+        int reportStep = -1;
+        std::vector<char> buffer;
+        std::string error;
+        try {
+            buffer = checkpoint_->read(reportStep);
+        }
+        catch (const std::exception& e) {
+            error = e.what();
+        }
+        const int minStep = comm.min(reportStep);
+        const int maxStep = comm.max(reportStep);
+        if (!error.empty()) {
+            OPM_THROW(std::runtime_error, error);
+        }
+        if (minStep != maxStep) {
+            OPM_THROW(std::runtime_error, "The checkpoint files of the processes were written "
+                      "at different report steps");
+        }
+        if (minStep < 0) {
+            OPM_THROW(std::runtime_error, "The checkpoint of another process could not be read");
+        }
+
+        EclMpiSerializer ser(comm);
+        ser.setBuffer(std::move(buffer));
+        ser.unpack(*this);
+        timer.setCurrentStepNum(reportStep);
+        // the keywords of the resumed report step are applied when it begins
+        ebosSimulator_.problem().applyGeoModifiersBefore(reportStep);
+
+        if (terminalOutput_) {
+            OpmLog::info("Continuing from the checkpoint at report step "
+                         + std::to_string(reportStep) + " in '" + checkpoint_->fileName() + "'");
+        }
+    }
+
 
     std::unique_ptr<Solver> createSolver(WellModel& wellModel)
     {
@@ -367,6 +553,9 @@ protected:
     std::unique_ptr<time::StopWatch> solverTimer_;
     std::unique_ptr<time::StopWatch> totalTimer_;
     std::unique_ptr<TimeStepper> adaptiveTimeStepping_;
+
+    std::unique_ptr<SimulatorCheckpoint> checkpoint_;
+    int checkpointInterval_{0};
 };
 
 } // namespace Opm
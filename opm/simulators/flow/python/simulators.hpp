@@ -37,6 +37,10 @@ private:
 
 public:
     BlackOilSimulator( const std::string &deckFilename);
+    BlackOilSimulator( std::shared_ptr<Opm::Deck> deck,
+                       std::shared_ptr<Opm::EclipseState> state,
+                       std::shared_ptr<Opm::Schedule> schedule,
+                       std::shared_ptr<Opm::SummaryConfig> summaryConfig);
     py::array_t<double> getPorosity();
     int run();
     void setPorosity(
@@ -46,7 +50,15 @@ public:
     int stepCleanup();
 
 private:
+    std::unique_ptr<Opm::Main> makeMain_() const;
+
     const std::string deckFilename_;
+    // Parsed input shared between the members of an ensemble, the
+    // simulator itself only ever works on copies of these.
+    std::shared_ptr<const Opm::Deck> deck_;
+    std::shared_ptr<const Opm::EclipseState> eclipseState_;
+    std::shared_ptr<const Opm::Schedule> schedule_;
+    std::shared_ptr<const Opm::SummaryConfig> summaryConfig_;
     bool hasRunInit_ = false;
     bool hasRunCleanup_ = false;
 
@@ -33,6 +33,7 @@
 #include <opm/simulators/linalg/findOverlapRowsAndColumns.hpp>
 #include <opm/simulators/linalg/getQuasiImpesWeights.hpp>
 #include <opm/simulators/linalg/setupPropertyTree.hpp>
+#include <opm/simulators/utils/PerformanceTrace.hpp>
 
 
 #if HAVE_CUDA || HAVE_OPENCL || HAVE_FPGA
@@ -128,6 +129,7 @@ namespace Opm
             prm_ = setupPropertyTree(parameters_,
                                      EWOMS_PARAM_IS_SET(TypeTag, int, LinearSolverMaxIter),
                                      EWOMS_PARAM_IS_SET(TypeTag, int, CprMaxEllIter));
+            parseCaptureIterations(parameters_.capture_linear_systems_);
 
 #if HAVE_CUDA || HAVE_OPENCL || HAVE_FPGA
             {
@@ -249,6 +251,10 @@ namespace Opm
                                     *rhs_,
                                     comm_.get());
             }
+            if (captureAllIterations_ ||
+                captureIterations_.count(simulator_.model().newtonMethod().numIterations()) > 0) {
+                captureSystem();
+            }
 
             // Solve system.
             Dune::InverseOperatorResult result;
@@ -289,7 +295,9 @@ namespace Opm
             // Otherwise, use flexible istl solver.
             if (!accelerator_was_used) {
                 assert(flexibleSolver_);
+                OPM_TRACE_SCOPE("preconditioned_solver_apply");
                 flexibleSolver_->apply(x, *rhs_, result);
+                OPM_TRACE_COUNT("linear_iterations", result.iterations);
             }
 
             // Check convergence, iterations etc.
@@ -355,6 +363,7 @@ namespace Opm
             std::function<Vector()> weightsCalculator = getWeightsCalculator();
 
             if (shouldCreateSolver()) {
+                OPM_TRACE_SCOPE("preconditioner_create");
                 if (isParallel()) {
 #if HAVE_MPI
                     if (useWellConn_) {
@@ -383,6 +392,7 @@ namespace Opm
             }
             else
             {
+                OPM_TRACE_SCOPE("preconditioner_update");
                 flexibleSolver_->preconditioner().update();
             }
         }
@@ -418,6 +428,47 @@ namespace Opm
         }
 
 
+        void parseCaptureIterations(const std::string& iterations)
+        {
+            std::istringstream is(iterations);
+            std::string item;
+            while (std::getline(is, item, ',')) {
+                if (item == "all") {
+                    captureAllIterations_ = true;
+                    continue;
+                }
+                try {
+                    captureIterations_.insert(std::stoi(item));
+                } catch (const std::exception&) {
+                    OPM_THROW(std::invalid_argument,
+                              "Invalid Newton iteration '" << item << "' in --capture-linear-systems,"
+                              << " expected 'all' or a comma separated list of iterations.");
+                }
+            }
+        }
+
+        // Write the linear system in binary form, for replay with flow_linsolve_bench.
+        // The well contributions are stored as a separate matrix unless they are
+        // already part of the system matrix.
+        void captureSystem() const
+        {
+            std::unique_ptr<SparseMatrixAdapter> wellMatrix;
+            if (!useWellConn_) {
+                wellMatrix = std::make_unique<SparseMatrixAdapter>(simulator_);
+                simulator_.problem().wellModel().assembleWellContributionMatrix(*wellMatrix);
+            }
+            std::unique_ptr<Vector> weights;
+            const auto weightsCalculator = getWeightsCalculator();
+            if (weightsCalculator) {
+                weights = std::make_unique<Vector>(weightsCalculator());
+            }
+            Helper::captureSystem(simulator_,
+                                  getMatrix(),
+                                  *rhs_,
+                                  wellMatrix ? &wellMatrix->istlMatrix() : nullptr,
+                                  weights.get());
+        }
+
         /// Return an appropriate weight function if a cpr preconditioner is asked for.
         std::function<Vector()> getWeightsCalculator() const
         {
@@ -514,6 +565,8 @@ namespace Opm
 
         bool useWellConn_;
         size_t interiorCellNum_;
+        std::set<int> captureIterations_;
+        bool captureAllIterations_ = false;
 
         FlowLinearSolverParameters parameters_;
         PropertyTree prm_;
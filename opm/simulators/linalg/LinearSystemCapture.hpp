@@ -0,0 +1,256 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_LINEARSYSTEMCAPTURE_HEADER_INCLUDED
+#define OPM_LINEARSYSTEMCAPTURE_HEADER_INCLUDED
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Opm
+{
+namespace LinearSystemCapture
+{
+    // Binary capture of a block linear system, all values in native byte order:
+    //
+    //   char[8]   magic "OPMLSYS\n"
+    //   uint32    format version
+    //   uint32    block size
+    //   matrix    reservoir matrix A
+    //   vector    right hand side b
+    //   uint8     1 if the well contributions follow, else 0
+    //   matrix    well contributions W, to be added to A
+    //   uint8     1 if the CPR weights follow, else 0
+    //   vector    CPR weights
+    //
+    // where a matrix is stored in block CSR form
+    //
+    //   uint64    number of block rows N
+    //   uint64    number of nonzero blocks nnz
+    //   uint64    rowStart[N+1]
+    //   uint32    column[nnz]
+    //   double    value[nnz*bs*bs], each block in row major order
+    //
+    // and a vector as
+    //
+    //   uint64    number of blocks N
+    //   double    value[N*bs]
+
+    constexpr char magic[] = "OPMLSYS\n";
+    constexpr std::uint32_t formatVersion = 1;
+
+    namespace detail
+    {
+        template <class T>
+        void write(std::ostream& os, const T& value)
+        {
+            os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <class T>
+        void writeArray(std::ostream& os, const std::vector<T>& values)
+        {
+            os.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+        }
+
+        template <class T>
+        T read(std::istream& is)
+        {
+            T value;
+            if (!is.read(reinterpret_cast<char*>(&value), sizeof(T))) {
+                throw std::runtime_error("Linear system capture is truncated");
+            }
+            return value;
+        }
+
+        template <class T>
+        std::vector<T> readArray(std::istream& is, std::size_t size)
+        {
+            std::vector<T> values(size);
+            if (!is.read(reinterpret_cast<char*>(values.data()), size * sizeof(T))) {
+                throw std::runtime_error("Linear system capture is truncated");
+            }
+            return values;
+        }
+
+        template <class Matrix>
+        void writeMatrix(std::ostream& os, const Matrix& matrix)
+        {
+            constexpr int bs = Matrix::block_type::rows;
+            std::vector<std::uint64_t> rowStart(1, 0);
+            std::vector<std::uint32_t> columns;
+            std::vector<double> values;
+            rowStart.reserve(matrix.N() + 1);
+            columns.reserve(matrix.nonzeroes());
+            values.reserve(matrix.nonzeroes() * bs * bs);
+            for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+                for (auto col = row->begin(); col != row->end(); ++col) {
+                    columns.push_back(col.index());
+                    for (int i = 0; i < bs; ++i) {
+                        for (int j = 0; j < bs; ++j) {
+                            values.push_back((*col)[i][j]);
+                        }
+                    }
+                }
+                rowStart.push_back(columns.size());
+            }
+            write<std::uint64_t>(os, matrix.N());
+            write<std::uint64_t>(os, columns.size());
+            writeArray(os, rowStart);
+            writeArray(os, columns);
+            writeArray(os, values);
+        }
+
+        template <class Vector>
+        void writeVector(std::ostream& os, const Vector& vector)
+        {
+            constexpr int bs = Vector::block_type::dimension;
+            std::vector<double> values;
+            values.reserve(vector.size() * bs);
+            for (const auto& block : vector) {
+                for (int i = 0; i < bs; ++i) {
+                    values.push_back(block[i]);
+                }
+            }
+            write<std::uint64_t>(os, vector.size());
+            writeArray(os, values);
+        }
+
+        template <class Matrix>
+        void readMatrix(std::istream& is, Matrix& matrix)
+        {
+            constexpr int bs = Matrix::block_type::rows;
+            const auto n = read<std::uint64_t>(is);
+            const auto nnz = read<std::uint64_t>(is);
+            const auto rowStart = readArray<std::uint64_t>(is, n + 1);
+            const auto columns = readArray<std::uint32_t>(is, nnz);
+            const auto values = readArray<double>(is, nnz * bs * bs);
+
+            matrix = Matrix();
+            matrix.setBuildMode(Matrix::row_wise);
+            matrix.setSize(n, n, nnz);
+            for (auto row = matrix.createbegin(); row != matrix.createend(); ++row) {
+                for (auto k = rowStart[row.index()]; k < rowStart[row.index() + 1]; ++k) {
+                    row.insert(columns[k]);
+                }
+            }
+
+            std::size_t k = 0;
+            for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+                for (auto col = row->begin(); col != row->end(); ++col, ++k) {
+                    for (int i = 0; i < bs; ++i) {
+                        for (int j = 0; j < bs; ++j) {
+                            (*col)[i][j] = values[k*bs*bs + i*bs + j];
+                        }
+                    }
+                }
+            }
+        }
+
+        template <class Vector>
+        void readVector(std::istream& is, Vector& vector)
+        {
+            constexpr int bs = Vector::block_type::dimension;
+            const auto n = read<std::uint64_t>(is);
+            const auto values = readArray<double>(is, n * bs);
+            vector.resize(n);
+            for (std::size_t k = 0; k < n; ++k) {
+                for (int i = 0; i < bs; ++i) {
+                    vector[k][i] = values[k*bs + i];
+                }
+            }
+        }
+    } // namespace detail
+
+    /// Write a linear system. The well contributions and the CPR weights
+    /// are optional and skipped if nullptr.
+    template <class Matrix, class Vector>
+    void write(const std::string& filename,
+               const Matrix& matrix,
+               const Vector& rhs,
+               const Matrix* wellMatrix,
+               const Vector* weights)
+    {
+        std::ofstream os(filename, std::ios::binary);
+        os.write(magic, sizeof(magic) - 1);
+        detail::write(os, formatVersion);
+        detail::write<std::uint32_t>(os, Matrix::block_type::rows);
+        detail::writeMatrix(os, matrix);
+        detail::writeVector(os, rhs);
+        detail::write<std::uint8_t>(os, wellMatrix != nullptr);
+        if (wellMatrix) {
+            detail::writeMatrix(os, *wellMatrix);
+        }
+        detail::write<std::uint8_t>(os, weights != nullptr);
+        if (weights) {
+            detail::writeVector(os, *weights);
+        }
+        if (!os) {
+            throw std::runtime_error("Could not write linear system capture " + filename);
+        }
+    }
+
+    /// Read the block size of a captured linear system.
+    inline int blockSize(const std::string& filename)
+    {
+        std::ifstream is(filename, std::ios::binary);
+        char header[sizeof(magic) - 1];
+        if (!is.read(header, sizeof(header)) || std::memcmp(header, magic, sizeof(header)) != 0) {
+            throw std::runtime_error(filename + " is not a linear system capture");
+        }
+        if (detail::read<std::uint32_t>(is) != formatVersion) {
+            throw std::runtime_error(filename + " has an unsupported capture format version");
+        }
+        return detail::read<std::uint32_t>(is);
+    }
+
+    /// Read a linear system. The well matrix and the weights are left empty
+    /// if they were not captured.
+    template <class Matrix, class Vector>
+    void read(const std::string& filename,
+              Matrix& matrix,
+              Vector& rhs,
+              Matrix& wellMatrix,
+              Vector& weights)
+    {
+        if (blockSize(filename) != Matrix::block_type::rows) {
+            throw std::runtime_error(filename + " has a different block size");
+        }
+        std::ifstream is(filename, std::ios::binary);
+        is.seekg(sizeof(magic) - 1 + 2 * sizeof(std::uint32_t));
+        detail::readMatrix(is, matrix);
+        detail::readVector(is, rhs);
+        wellMatrix = Matrix();
+        if (detail::read<std::uint8_t>(is)) {
+            detail::readMatrix(is, wellMatrix);
+        }
+        weights.resize(0);
+        if (detail::read<std::uint8_t>(is)) {
+            detail::readVector(is, weights);
+        }
+    }
+
+} // namespace LinearSystemCapture
+} // namespace Opm
+
+#endif // OPM_LINEARSYSTEMCAPTURE_HEADER_INCLUDED
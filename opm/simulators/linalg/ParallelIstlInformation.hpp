@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <type_traits>
 #include <vector>
@@ -43,6 +44,7 @@
 #include <dune/common/parallel/communicator.hh>
 #include <dune/common/enumset.hh>
 #include <opm/common/utility/platform_dependent/reenable_warnings.h>
+#include <opm/simulators/linalg/SharedMemoryHaloExchange.hpp>
 
 namespace Opm
 {
@@ -96,7 +98,7 @@ public:
     /// The information will be shared by the the two objects.
     ParallelISTLInformation(const ParallelISTLInformation& other)
     : indexSet_(other.indexSet_), remoteIndices_(other.remoteIndices_),
-      communicator_(other.communicator_)
+      communicator_(other.communicator_), haloExchange_(other.haloExchange_)
     {}
     /// \brief Get a pointer to the underlying index set.
     std::shared_ptr<ParallelIndexSet> indexSet() const
@@ -144,21 +146,17 @@ public:
     template<class T>
     void copyOwnerToAll (const T& source, T& dest) const
     {
-        typedef Dune::Combine<Dune::EnumItem<Dune::OwnerOverlapCopyAttributeSet::AttributeSet,Dune::OwnerOverlapCopyAttributeSet::owner>,Dune::EnumItem<Dune::OwnerOverlapCopyAttributeSet::AttributeSet,Dune::OwnerOverlapCopyAttributeSet::overlap>,Dune::OwnerOverlapCopyAttributeSet::AttributeSet> OwnerOverlapSet;
-        typedef Dune::EnumItem<Dune::OwnerOverlapCopyAttributeSet::AttributeSet,Dune::OwnerOverlapCopyAttributeSet::owner> OwnerSet;
-        typedef Dune::Combine<OwnerOverlapSet, Dune::EnumItem<Dune::OwnerOverlapCopyAttributeSet::AttributeSet,Dune::OwnerOverlapCopyAttributeSet::copy>,Dune::OwnerOverlapCopyAttributeSet::AttributeSet> AllSet;
-      OwnerSet sourceFlags;
-      AllSet destFlags;
-      Dune::Interface interface(communicator_);
       if( !remoteIndices_->isSynced() )
       {
           remoteIndices_->rebuild<false>();
+          haloExchange_.reset();
       }
-      interface.build(*remoteIndices_,sourceFlags,destFlags);
-      Dune::BufferedCommunicator communicator;
-      communicator.template build<T>(interface);
-      communicator.template forward<CopyGatherScatter<T> >(source,dest);
-      communicator.free();
+      // processes on the same node exchange through shared memory
+      if( !haloExchange_ )
+      {
+          haloExchange_ = std::make_shared<SharedMemoryHaloExchange>(*remoteIndices_, communicator_);
+      }
+      haloExchange_->copyOwnerToAll(source, dest);
     }
     template<class T>
     const std::vector<double>& updateOwnerMask(const T& container) const
@@ -326,22 +324,6 @@ private:
         }
         computeLocalReduction<I+1>(containers, operators, values);
     }
-    /** \brief gather/scatter callback for communcation */
-    template<typename T>
-    struct CopyGatherScatter
-    {
-        typedef typename Dune::CommPolicy<T>::IndexedType V;
-
-      static V gather(const T& a, std::size_t i)
-      {
-        return a[i];
-      }
-
-      static void scatter(T& a, V v, std::size_t i)
-      {
-        a[i] = v;
-      }
-    };
     template<class T>
     class IndexSetInserter
     {
@@ -376,6 +358,8 @@ private:
     std::shared_ptr<RemoteIndices> remoteIndices_;
     Dune::CollectiveCommunication<MPI_Comm> communicator_;
     mutable std::vector<double> ownerMask_;
+    /// \brief The copy owner to all communication, set up on first use.
+    mutable std::shared_ptr<SharedMemoryHaloExchange> haloExchange_;
 };
 
     namespace Reduction
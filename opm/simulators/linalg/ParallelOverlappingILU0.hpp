@@ -22,6 +22,7 @@
 
 #include <opm/simulators/linalg/GraphColoring.hpp>
 #include <opm/simulators/linalg/PreconditionerWithUpdate.hpp>
+#include <opm/simulators/linalg/SharedMemoryHaloExchange.hpp>
 #include <opm/common/ErrorMacros.hpp>
 #include <dune/common/version.hh>
 #include <dune/istl/preconditioner.hh>
@@ -33,6 +34,7 @@
 #include <numeric>
 #include <limits>
 #include <cstddef>
+#include <memory>
 #include <string>
 
 namespace Opm
@@ -906,6 +908,17 @@ public:
     void copyOwnerToAll( V& v ) const
     {
         if( comm_ ) {
+#if HAVE_MPI
+            if constexpr( !std::is_same<ParallelInfo, Dune::Amg::SequentialInformation>::value ) {
+                // processes on the same node exchange through shared memory
+                if( !haloExchange_ ) {
+                    haloExchange_ = std::make_unique<SharedMemoryHaloExchange>(comm_->remoteIndices(),
+                                                                               comm_->communicator());
+                }
+                haloExchange_->copyOwnerToAll(v, v);
+                return;
+            }
+#endif
             comm_->copyOwnerToAll(v, v);
         }
     }
@@ -1134,6 +1147,10 @@ protected:
     Domain reorderedV_;
 
     const ParallelInfo* comm_;
+#if HAVE_MPI
+    //! \brief The copy owner to all communication, set up on first use.
+    mutable std::unique_ptr<SharedMemoryHaloExchange> haloExchange_;
+#endif
     //! \brief The relaxation factor to use.
     const field_type w_;
     const bool relaxation_;
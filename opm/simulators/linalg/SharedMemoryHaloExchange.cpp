@@ -0,0 +1,217 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/simulators/linalg/SharedMemoryHaloExchange.hpp>
+
+#include <stdexcept>
+
+namespace Opm
+{
+
+namespace
+{
+    // Message tag of the exchange with the processes on other nodes.
+    constexpr int haloExchangeTag = 7341;
+}
+
+SharedMemoryHaloExchange::
+SharedMemoryHaloExchange(std::vector<Neighbour> neighbours,
+                         MPI_Comm comm,
+                         bool useSharedMemory)
+    : comm_(comm)
+{
+    int nodeSize = 1;
+    if (useSharedMemory) {
+        int rank = 0;
+        MPI_Comm_rank(comm, &rank);
+        MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm_);
+        MPI_Comm_size(nodeComm_, &nodeSize);
+        if (nodeSize == 1) {
+            MPI_Comm_free(&nodeComm_);
+            nodeComm_ = MPI_COMM_NULL;
+        }
+    }
+
+    if (nodeComm_ == MPI_COMM_NULL) {
+        remoteNeighbours_ = std::move(neighbours);
+    } else {
+        setupNodeNeighbours_(std::move(neighbours), nodeSize);
+    }
+
+    // A process reading beyond the values published for it would access
+    // memory of another process. The check is collective such that all
+    // processes throw instead of some of them waiting for the others.
+    int consistent = haloConsistent_ ? 1 : 0;
+    MPI_Allreduce(MPI_IN_PLACE, &consistent, 1, MPI_INT, MPI_MIN, comm_);
+    if (!consistent) {
+        if (nodeComm_ != MPI_COMM_NULL)
+            MPI_Comm_free(&nodeComm_);
+        throw std::logic_error("Inconsistent halo of processes on the same node");
+    }
+}
+
+void SharedMemoryHaloExchange::setupNodeNeighbours_(std::vector<Neighbour> neighbours,
+                                                    int nodeSize)
+{
+    // sort the neighbours by whether they are on this node
+    MPI_Group group, nodeGroup;
+    MPI_Comm_group(comm_, &group);
+    MPI_Comm_group(nodeComm_, &nodeGroup);
+    std::vector<int> ranks, nodeRanks(neighbours.size());
+    for (const auto& neighbour : neighbours)
+        ranks.push_back(neighbour.rank);
+    MPI_Group_translate_ranks(group, ranks.size(), ranks.data(), nodeGroup, nodeRanks.data());
+    MPI_Group_free(&group);
+    MPI_Group_free(&nodeGroup);
+
+    for (std::size_t n = 0; n < neighbours.size(); ++n) {
+        if (nodeRanks[n] == MPI_UNDEFINED) {
+            remoteNeighbours_.push_back(std::move(neighbours[n]));
+        } else {
+            neighbours[n].rank = nodeRanks[n];
+            publishOffset_.push_back(publishSize_);
+            publishSize_ += neighbours[n].send.size();
+            nodeNeighbours_.push_back(std::move(neighbours[n]));
+        }
+    }
+
+    // tell every node neighbour where its values are in our window and
+    // how many there are
+    std::vector<unsigned long long> published(2 * nodeSize, 0), neighbourPublished(2 * nodeSize, 0);
+    for (std::size_t n = 0; n < nodeNeighbours_.size(); ++n) {
+        published[2 * nodeNeighbours_[n].rank] = publishOffset_[n];
+        published[2 * nodeNeighbours_[n].rank + 1] = nodeNeighbours_[n].send.size();
+    }
+    MPI_Alltoall(published.data(), 2, MPI_UNSIGNED_LONG_LONG,
+                 neighbourPublished.data(), 2, MPI_UNSIGNED_LONG_LONG, nodeComm_);
+    for (const auto& neighbour : nodeNeighbours_) {
+        readOffset_.push_back(neighbourPublished[2 * neighbour.rank]);
+        if (neighbourPublished[2 * neighbour.rank + 1] != neighbour.recv.size())
+            haloConsistent_ = false;
+    }
+}
+
+SharedMemoryHaloExchange::~SharedMemoryHaloExchange()
+{
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (finalized)
+        return;
+
+    freeWindow_();
+    if (nodeComm_ != MPI_COMM_NULL)
+        MPI_Comm_free(&nodeComm_);
+}
+
+void SharedMemoryHaloExchange::startMessages_(std::size_t blockBytes) const
+{
+    sendBuffers_.resize(remoteNeighbours_.size());
+    recvBuffers_.resize(remoteNeighbours_.size());
+    requests_.clear();
+    for (std::size_t n = 0; n < remoteNeighbours_.size(); ++n) {
+        const auto& neighbour = remoteNeighbours_[n];
+        sendBuffers_[n].resize(neighbour.send.size() * blockBytes);
+        recvBuffers_[n].resize(neighbour.recv.size() * blockBytes);
+        if (!recvBuffers_[n].empty()) {
+            requests_.emplace_back();
+            MPI_Irecv(recvBuffers_[n].data(), recvBuffers_[n].size(), MPI_BYTE,
+                      neighbour.rank, haloExchangeTag, comm_, &requests_.back());
+        }
+    }
+}
+
+void SharedMemoryHaloExchange::sendMessages_() const
+{
+    for (std::size_t n = 0; n < remoteNeighbours_.size(); ++n) {
+        if (!sendBuffers_[n].empty()) {
+            requests_.emplace_back();
+            MPI_Isend(sendBuffers_[n].data(), sendBuffers_[n].size(), MPI_BYTE,
+                      remoteNeighbours_[n].rank, haloExchangeTag, comm_, &requests_.back());
+        }
+    }
+}
+
+void SharedMemoryHaloExchange::waitForMessages_() const
+{
+    MPI_Waitall(requests_.size(), requests_.data(), MPI_STATUSES_IGNORE);
+}
+
+char* SharedMemoryHaloExchange::beginPublish_(std::size_t blockBytes) const
+{
+    // all processes of the node exchange the same vector type, hence
+    // they reallocate together
+    if (blockBytes != blockBytes_)
+        allocateWindow_(blockBytes);
+    else
+        parity_ = 1 - parity_;
+    return ownValues_ + parity_ * publishSize_ * blockBytes_;
+}
+
+void SharedMemoryHaloExchange::endPublish_() const
+{
+    MPI_Win_sync(window_);
+    MPI_Barrier(nodeComm_);
+    MPI_Win_sync(window_);
+}
+
+const char* SharedMemoryHaloExchange::neighbourValues_(std::size_t n) const
+{
+    return neighbourBase_[n] + parity_ * neighbourHalf_[n] + readOffset_[n] * blockBytes_;
+}
+
+void SharedMemoryHaloExchange::allocateWindow_(std::size_t blockBytes) const
+{
+    freeWindow_();
+
+    void* base = nullptr;
+    MPI_Win_allocate_shared(2 * publishSize_ * blockBytes, /*disp_unit=*/1, MPI_INFO_NULL,
+                            nodeComm_, &base, &window_);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, window_);
+    ownValues_ = static_cast<char*>(base);
+    blockBytes_ = blockBytes;
+    parity_ = 0;
+
+    neighbourBase_.clear();
+    neighbourHalf_.clear();
+    for (const auto& neighbour : nodeNeighbours_) {
+        MPI_Aint size = 0;
+        int dispUnit = 0;
+        void* neighbourBase = nullptr;
+        // the sizes were checked in the constructor
+        MPI_Win_shared_query(window_, neighbour.rank, &size, &dispUnit, &neighbourBase);
+        neighbourBase_.push_back(static_cast<const char*>(neighbourBase));
+        neighbourHalf_.push_back(size / 2);
+    }
+}
+
+void SharedMemoryHaloExchange::freeWindow_() const
+{
+    if (window_ == MPI_WIN_NULL)
+        return;
+
+    MPI_Win_unlock_all(window_);
+    MPI_Win_free(&window_);
+    window_ = MPI_WIN_NULL;
+    ownValues_ = nullptr;
+    blockBytes_ = 0;
+}
+
+} // namespace Opm
@@ -0,0 +1,242 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_SHAREDMEMORYHALOEXCHANGE_HEADER_INCLUDED
+#define OPM_SHAREDMEMORYHALOEXCHANGE_HEADER_INCLUDED
+
+#if HAVE_MPI
+
+#include <mpi.h>
+#include <dune/istl/owneroverlapcopy.hh>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Opm
+{
+
+/// \brief Copy owner to all communication of a distributed vector, where
+/// the processes on the same node exchange their values through shared
+/// memory instead of MPI messages.
+///
+/// Every process publishes the values it owns and that are needed by
+/// processes on the same node in an MPI-3 shared memory window. These
+/// read them directly from the window of the owner, there is no message
+/// and no intermediate buffer on the receiving side. The neighbours on
+/// other nodes are served by regular point to point messages.
+///
+/// Construction, destruction and copyOwnerToAll() are collective on the
+/// communicator.
+class SharedMemoryHaloExchange
+{
+public:
+    /// \brief The entries exchanged with a neighbouring process.
+    ///
+    /// The entries are ordered consistently on both processes, i.e. the
+    /// k-th entry sent to a process is its k-th received entry.
+    struct Neighbour
+    {
+        int rank;
+        std::vector<std::size_t> send;
+        std::vector<std::size_t> recv;
+    };
+
+    /// \brief Sets up the exchange from explicit neighbour lists.
+    ///
+    /// Throws std::logic_error on all processes if the number of values
+    /// sent to a process on the same node differs from the number of
+    /// values it receives.
+    /// \param neighbours The entries exchanged with each neighbour.
+    /// \param comm The communicator of the neighbour ranks.
+    /// \param useSharedMemory Whether to use shared memory for the
+    ///        neighbours on the same node. If false, all neighbours are
+    ///        served by messages.
+    SharedMemoryHaloExchange(std::vector<Neighbour> neighbours,
+                             MPI_Comm comm,
+                             bool useSharedMemory = true);
+
+    /// \brief Sets up the exchange from the remote indices of an owner
+    /// overlap copy index set.
+    ///
+    /// Entries owned by this process are sent to every process which has
+    /// them, entries owned by another process are received from it. This
+    /// is the same as Dune::OwnerOverlapCopyCommunication::copyOwnerToAll().
+    template<class RemoteIndices>
+    SharedMemoryHaloExchange(const RemoteIndices& remoteIndices,
+                             MPI_Comm comm,
+                             bool useSharedMemory = true)
+        : SharedMemoryHaloExchange(neighboursFromRemoteIndices(remoteIndices), comm, useSharedMemory)
+    {}
+
+    ~SharedMemoryHaloExchange();
+
+    SharedMemoryHaloExchange(const SharedMemoryHaloExchange&) = delete;
+    SharedMemoryHaloExchange& operator=(const SharedMemoryHaloExchange&) = delete;
+
+    /// \brief Copies the values of the owned entries of source to the
+    /// corresponding entries of dest on the other processes.
+    ///
+    /// Only the received entries of dest are written, source and dest
+    /// may be the same vector. The entries must be trivially copyable,
+    /// e.g. scalars or Dune::FieldVector blocks.
+    template<class Vector>
+    void copyOwnerToAll(const Vector& source, Vector& dest) const
+    {
+        using Block = std::decay_t<decltype(source[0])>;
+        constexpr std::size_t blockBytes = sizeof(Block);
+
+        // messages to and from the other nodes are in flight while the
+        // values on this node are exchanged
+        startMessages_(blockBytes);
+        for (std::size_t n = 0; n < remoteNeighbours_.size(); ++n) {
+            char* buffer = sendBuffers_[n].data();
+            for (const auto idx : remoteNeighbours_[n].send) {
+                std::memcpy(buffer, &source[idx], blockBytes);
+                buffer += blockBytes;
+            }
+        }
+        sendMessages_();
+
+        // all processes on the node take part, also the ones without node neighbours
+        if (nodeComm_ != MPI_COMM_NULL) {
+            char* published = beginPublish_(blockBytes);
+            for (std::size_t n = 0; n < nodeNeighbours_.size(); ++n) {
+                char* target = published + publishOffset_[n] * blockBytes;
+                for (const auto idx : nodeNeighbours_[n].send) {
+                    std::memcpy(target, &source[idx], blockBytes);
+                    target += blockBytes;
+                }
+            }
+            endPublish_();
+            for (std::size_t n = 0; n < nodeNeighbours_.size(); ++n) {
+                const char* values = neighbourValues_(n);
+                for (const auto idx : nodeNeighbours_[n].recv) {
+                    std::memcpy(&dest[idx], values, blockBytes);
+                    values += blockBytes;
+                }
+            }
+        }
+
+        waitForMessages_();
+        for (std::size_t n = 0; n < remoteNeighbours_.size(); ++n) {
+            const char* buffer = recvBuffers_[n].data();
+            for (const auto idx : remoteNeighbours_[n].recv) {
+                std::memcpy(&dest[idx], buffer, blockBytes);
+                buffer += blockBytes;
+            }
+        }
+    }
+
+    /// \brief The number of neighbours served through shared memory.
+    std::size_t numNodeNeighbours() const
+    {
+        return nodeNeighbours_.size();
+    }
+
+    /// \brief The number of neighbours served by messages.
+    std::size_t numRemoteNeighbours() const
+    {
+        return remoteNeighbours_.size();
+    }
+
+    /// \brief The neighbour lists of copyOwnerToAll() for the remote
+    /// indices of an owner overlap copy index set.
+    template<class RemoteIndices>
+    static std::vector<Neighbour> neighboursFromRemoteIndices(const RemoteIndices& remoteIndices)
+    {
+        constexpr auto owner = Dune::OwnerOverlapCopyAttributeSet::owner;
+
+        std::vector<Neighbour> neighbours;
+        for (auto it = remoteIndices.begin(); it != remoteIndices.end(); ++it) {
+            Neighbour neighbour{it->first, {}, {}};
+            for (const auto& remoteIndex : *it->second.first) {
+                const auto& local = remoteIndex.localIndexPair().local();
+                if (local.attribute() == owner)
+                    neighbour.send.push_back(local.local());
+                if (remoteIndex.attribute() == owner)
+                    neighbour.recv.push_back(local.local());
+            }
+            if (!neighbour.send.empty() || !neighbour.recv.empty())
+                neighbours.push_back(std::move(neighbour));
+        }
+        return neighbours;
+    }
+
+private:
+    // Sorts the neighbours by whether they are on this node and exchanges
+    // the layout of the published values with the node neighbours.
+    void setupNodeNeighbours_(std::vector<Neighbour> neighbours, int nodeSize);
+
+    // Posts the receives from the other nodes and sizes the send buffers.
+    void startMessages_(std::size_t blockBytes) const;
+    // Sends the packed buffers to the other nodes.
+    void sendMessages_() const;
+    // Waits for the messages from and to the other nodes.
+    void waitForMessages_() const;
+
+    // Returns the part of our window to write the published values to.
+    // (Re)allocates the window if the block size changed.
+    char* beginPublish_(std::size_t blockBytes) const;
+    // Makes the published values of all processes on the node visible.
+    void endPublish_() const;
+    // The values published for us by the n-th node neighbour.
+    const char* neighbourValues_(std::size_t n) const;
+
+    void allocateWindow_(std::size_t blockBytes) const;
+    void freeWindow_() const;
+
+    MPI_Comm comm_;
+    MPI_Comm nodeComm_ = MPI_COMM_NULL;
+
+    // neighbours on this node, the rank is the one in nodeComm_
+    std::vector<Neighbour> nodeNeighbours_;
+    // neighbours on other nodes, the rank is the one in comm_
+    std::vector<Neighbour> remoteNeighbours_;
+
+    // offset (in blocks) of the values for each node neighbour within
+    // the published part of our window and of the values for us within
+    // the published part of the window of the neighbour
+    std::vector<std::size_t> publishOffset_;
+    std::vector<std::size_t> readOffset_;
+    std::size_t publishSize_ = 0;
+    // whether every node neighbour publishes as many values as we receive
+    bool haloConsistent_ = true;
+
+    // The window holds two copies of the published values which are used
+    // alternately. A process can thus only overwrite values after all
+    // processes on the node have finished reading them in the previous
+    // exchange, with a single barrier per exchange.
+    mutable MPI_Win window_ = MPI_WIN_NULL;
+    mutable std::size_t blockBytes_ = 0;
+    mutable char* ownValues_ = nullptr;
+    mutable std::vector<const char*> neighbourBase_;
+    mutable std::vector<std::size_t> neighbourHalf_;
+    mutable int parity_ = 0;
+
+    mutable std::vector<std::vector<char>> sendBuffers_;
+    mutable std::vector<std::vector<char>> recvBuffers_;
+    mutable std::vector<MPI_Request> requests_;
+};
+
+} // namespace Opm
+
+#endif // HAVE_MPI
+
+#endif // OPM_SHAREDMEMORYHALOEXCHANGE_HEADER_INCLUDED
@@ -21,18 +21,20 @@
 #define OPM_WRITESYSTEMMATRIXHELPER_HEADER_INCLUDED
 
 #include <dune/istl/matrixmarket.hh>
+#include <opm/simulators/linalg/LinearSystemCapture.hpp>
 #include <opm/simulators/linalg/MatrixMarketSpecializations.hpp>
 
+#include <string>
+
 
 namespace Opm
 {
 namespace Helper
 {
-    template <class SimulatorType, class MatrixType, class VectorType, class Communicator>
-    void writeSystem(const SimulatorType& simulator,
-                     const MatrixType& matrix,
-                     const VectorType& rhs,
-                     [[maybe_unused]] const Communicator* comm)
+    // Common prefix of the files describing the linear system of the current
+    // Newton iteration, in the reports subdirectory of the output directory.
+    template <class SimulatorType>
+    std::string systemFilePrefix(const SimulatorType& simulator)
     {
         std::string dir = simulator.problem().outputDir();
         if (dir == ".") {
@@ -55,7 +57,16 @@ namespace Helper
         oss << "_nit_" << nit << "_";
         std::string output_file(oss.str());
         fs::path full_path = output_dir / output_file;
-        std::string prefix = full_path.string();
+        return full_path.string();
+    }
+
+    template <class SimulatorType, class MatrixType, class VectorType, class Communicator>
+    void writeSystem(const SimulatorType& simulator,
+                     const MatrixType& matrix,
+                     const VectorType& rhs,
+                     [[maybe_unused]] const Communicator* comm)
+    {
+        const std::string prefix = systemFilePrefix(simulator);
         {
             std::string filename = prefix + "matrix_istl";
 #if HAVE_MPI
@@ -80,6 +91,19 @@ namespace Helper
         }
     }
 
+    // Write the local linear system of this process in the binary format of
+    // LinearSystemCapture, see there.
+    template <class SimulatorType, class MatrixType, class VectorType>
+    void captureSystem(const SimulatorType& simulator,
+                       const MatrixType& matrix,
+                       const VectorType& rhs,
+                       const MatrixType* wellMatrix,
+                       const VectorType* weights)
+    {
+        const int rank = simulator.gridView().comm().rank();
+        const std::string filename = systemFilePrefix(simulator) + "system." + std::to_string(rank) + ".bin";
+        LinearSystemCapture::write(filename, matrix, rhs, wellMatrix, weights);
+    }
 
 } // namespace Helper
 } // namespace Opm
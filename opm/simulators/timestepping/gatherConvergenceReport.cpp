@@ -21,6 +21,7 @@
 #include "config.h"
 
 #include <opm/simulators/timestepping/gatherConvergenceReport.hpp>
+#include <opm/simulators/utils/PerformanceTrace.hpp>
 
 #if HAVE_MPI
 
@@ -169,6 +170,7 @@ namespace Opm
     /// (per-process) reports.
     ConvergenceReport gatherConvergenceReport(const ConvergenceReport& local_report)
     {
+        OPM_TRACE_SCOPE("convergence_gather");
         // Pack local report.
         int message_size = messageSize(local_report);
         std::vector<char> buffer(message_size);
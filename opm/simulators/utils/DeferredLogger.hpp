@@ -84,6 +84,10 @@ enum ExcEnum {
         /// Clear the message container without logging them.
         void clearMessages();
 
+        /// Move the messages of another logger, e.g. of another thread,
+        /// to the end of this one.
+        void append(DeferredLogger& other);
+
     private:
         std::vector<Message> messages_;
         friend DeferredLogger gatherDeferredLogger(const DeferredLogger& local_deferredlogger);
@@ -43,9 +43,7 @@ void eclStateBroadcast(EclipseState& eclState, Schedule& schedule,
                        SummaryConfig& summaryConfig)
 {
     Opm::EclMpiSerializer ser(Dune::MPIHelper::getCollectiveCommunication());
-    ser.broadcast(eclState);
-    ser.broadcast(schedule);
-    ser.broadcast(summaryConfig);
+    ser.broadcast(eclState, schedule, summaryConfig);
 }
 
 void eclScheduleBroadcast(Schedule& schedule)
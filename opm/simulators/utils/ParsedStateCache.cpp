@@ -0,0 +1,247 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/simulators/utils/ParsedStateCache.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/FileSystem.hpp>
+
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
+#include <opm/parser/eclipse/Parser/ParseContext.hpp>
+
+#include <ebos/eclmpiserializer.hh>
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+namespace {
+
+// Bump whenever the layout of the cache files changes.
+constexpr std::uint64_t cacheFormatVersion = 2;
+const std::string cacheMagic = "OPM_PARSED_STATE";
+
+// 64 bit FNV-1a, stable across platforms and builds unlike std::hash.
+std::uint64_t hashBytes(const char* data, std::size_t size)
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool hashFile(const std::string& filename, std::uint64_t& hash)
+{
+    std::ifstream is(filename, std::ios::binary);
+    if (!is)
+        return false;
+
+    const std::vector<char> content((std::istreambuf_iterator<char>(is)),
+                                    std::istreambuf_iterator<char>());
+    hash = hashBytes(content.data(), content.size());
+    return true;
+}
+
+// Hash of the settings which change the parsed state for the same input
+// files: the action for each input error and whether wells and groups are
+// initialized from a restart file.
+std::uint64_t hashSettings(const ParseContext& parseContext, bool initFromRestart)
+{
+    std::string settings = initFromRestart ? "restart;" : "norestart;";
+    for (const auto& [key, action] : parseContext)
+        settings += fmt::format("{}={};", key, static_cast<int>(action));
+    return hashBytes(settings.data(), settings.size());
+}
+
+std::string cacheFileName(const std::string& cacheDir,
+                          const std::string& deckFilename,
+                          std::uint64_t deckHash,
+                          std::uint64_t settingsHash)
+{
+    const auto stem = filesystem::path(deckFilename).stem().string();
+    return (filesystem::path(cacheDir) /
+            fmt::format("{}-{:016x}-{:016x}.OPMCACHE", stem, deckHash, settingsHash)).string();
+}
+
+template<class T>
+void writeValue(std::ostream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<class T>
+bool readValue(std::istream& is, T& value)
+{
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+void writeString(std::ostream& os, const std::string& str)
+{
+    writeValue(os, static_cast<std::uint64_t>(str.size()));
+    os.write(str.data(), str.size());
+}
+
+bool readString(std::istream& is, std::string& str)
+{
+    std::uint64_t size = 0;
+    if (!readValue(is, size))
+        return false;
+    str.resize(size);
+    return static_cast<bool>(is.read(str.data(), size));
+}
+
+// All files the parser has read keywords from, including the deck itself.
+std::set<std::string> inputFiles(const Deck& deck, const std::string& deckFilename)
+{
+    std::set<std::string> files { deckFilename };
+    for (std::size_t i = 0; i < deck.size(); ++i) {
+        const auto& filename = deck.getKeyword(i).location().filename;
+        if (!filename.empty())
+            files.insert(filename);
+    }
+    return files;
+}
+
+} // anonymous namespace
+
+bool loadParsedStateCache(const std::string& cacheDir,
+                          const std::string& deckFilename,
+                          const ParseContext& parseContext,
+                          bool initFromRestart,
+                          Deck& deck, Schedule& schedule,
+                          SummaryConfig& summaryConfig)
+{
+    std::uint64_t deckHash;
+    if (!hashFile(deckFilename, deckHash))
+        return false;
+
+    const auto filename = cacheFileName(cacheDir, deckFilename, deckHash,
+                                        hashSettings(parseContext, initFromRestart));
+    std::ifstream is(filename, std::ios::binary);
+    if (!is)
+        return false;
+
+    std::string magic;
+    std::uint64_t version = 0;
+    if (!readString(is, magic) || magic != cacheMagic ||
+        !readValue(is, version) || version != cacheFormatVersion)
+        return false;
+
+    // The entry is only valid if no input file has changed since it was stored.
+    std::uint64_t numFiles = 0;
+    if (!readValue(is, numFiles))
+        return false;
+    for (std::uint64_t i = 0; i < numFiles; ++i) {
+        std::string inputFile;
+        std::uint64_t storedHash = 0;
+        std::uint64_t currentHash = 0;
+        if (!readString(is, inputFile) || !readValue(is, storedHash) ||
+            !hashFile(inputFile, currentHash) || currentHash != storedHash)
+            return false;
+    }
+
+    std::uint64_t size = 0;
+    if (!readValue(is, size))
+        return false;
+    std::vector<char> buffer(size);
+    if (!is.read(buffer.data(), size))
+        return false;
+
+    try {
+        EclMpiSerializer ser(Dune::MPIHelper::getCollectiveCommunication());
+        ser.setBuffer(std::move(buffer));
+        ser.unpack(deck, schedule, summaryConfig);
+    }
+    catch (const std::exception& e) {
+        OpmLog::warning(fmt::format("Ignoring unreadable parsed state cache '{}': {}", filename, e.what()));
+        return false;
+    }
+
+    OpmLog::info(fmt::format("Loaded parsed deck from cache '{}'", filename));
+    return true;
+}
+
+void storeParsedStateCache(const std::string& cacheDir,
+                           const std::string& deckFilename,
+                           const ParseContext& parseContext,
+                           bool initFromRestart,
+                           Deck& deck, Schedule& schedule,
+                           SummaryConfig& summaryConfig)
+{
+    try {
+        std::uint64_t deckHash;
+        if (!hashFile(deckFilename, deckHash))
+            return;
+
+        const auto files = inputFiles(deck, deckFilename);
+        std::vector<std::pair<std::string, std::uint64_t>> fileHashes;
+        for (const auto& inputFile : files) {
+            std::uint64_t hash;
+            if (!hashFile(inputFile, hash))
+                return;
+            fileHashes.emplace_back(inputFile, hash);
+        }
+
+        EclMpiSerializer ser(Dune::MPIHelper::getCollectiveCommunication());
+        ser.pack(deck, schedule, summaryConfig);
+
+        filesystem::create_directories(cacheDir);
+        const auto filename = cacheFileName(cacheDir, deckFilename, deckHash,
+                                            hashSettings(parseContext, initFromRestart));
+
+        // Write to a temporary file first so that concurrent runs never see
+        // a partially written entry.
+        const auto tmpFilename = filename + ".tmp";
+        {
+            std::ofstream os(tmpFilename, std::ios::binary | std::ios::trunc);
+            writeString(os, cacheMagic);
+            writeValue(os, cacheFormatVersion);
+            writeValue(os, static_cast<std::uint64_t>(fileHashes.size()));
+            for (const auto& [inputFile, hash] : fileHashes) {
+                writeString(os, inputFile);
+                writeValue(os, hash);
+            }
+            writeValue(os, static_cast<std::uint64_t>(ser.position()));
+            os.write(ser.buffer().data(), ser.position());
+            if (!os)
+                throw std::runtime_error("Write failure");
+        }
+        filesystem::rename(tmpFilename, filename);
+    }
+    catch (const std::exception& e) {
+        OpmLog::warning(fmt::format("Could not store parsed state cache in '{}': {}", cacheDir, e.what()));
+    }
+}
+
+} // end namespace Opm
@@ -0,0 +1,67 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_PARSED_STATE_CACHE_HPP
+#define OPM_PARSED_STATE_CACHE_HPP
+
+#include <string>
+
+namespace Opm {
+
+class Deck;
+class ParseContext;
+class Schedule;
+class SummaryConfig;
+
+/*! \brief Loads a parsed deck, schedule and summary configuration from the cache.
+ *! \details The cache entry for a deck is located through a hash of the
+ *!          deck file and of the settings the deck was parsed with, and is
+ *!          only used if none of the files read while parsing the deck has
+ *!          changed since the entry was stored.
+ *! \param cacheDir Directory holding the cache entries
+ *! \param deckFilename Name of the deck file
+ *! \param parseContext Error handling the deck is parsed with
+ *! \param initFromRestart Whether wells and groups are initialized from a restart file
+ *! \return True if a valid entry was found and loaded
+*/
+bool loadParsedStateCache(const std::string& cacheDir,
+                          const std::string& deckFilename,
+                          const ParseContext& parseContext,
+                          bool initFromRestart,
+                          Deck& deck, Schedule& schedule,
+                          SummaryConfig& summaryConfig);
+
+/*! \brief Stores a parsed deck, schedule and summary configuration in the cache.
+ *! \details Failure to write the cache entry is reported as a warning only.
+ *!          A schedule initialized from a restart file must not be stored, it
+ *!          depends on more than the input files.
+ *! \param cacheDir Directory holding the cache entries, created if needed
+ *! \param deckFilename Name of the deck file
+ *! \param parseContext Error handling the deck was parsed with
+ *! \param initFromRestart Whether wells and groups are initialized from a restart file
+*/
+void storeParsedStateCache(const std::string& cacheDir,
+                           const std::string& deckFilename,
+                           const ParseContext& parseContext,
+                           bool initFromRestart,
+                           Deck& deck, Schedule& schedule,
+                           SummaryConfig& summaryConfig);
+
+} // end namespace Opm
+
+#endif // OPM_PARSED_STATE_CACHE_HPP
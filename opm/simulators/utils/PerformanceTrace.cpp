@@ -0,0 +1,221 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/simulators/utils/PerformanceTrace.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+#if _OPENMP
+#include <omp.h>
+#endif
+
+namespace
+{
+
+    std::string escapeJson(const std::string& str)
+    {
+        std::string result;
+        result.reserve(str.size());
+        for (const char c : str) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+            }
+            result += c;
+        }
+        return result;
+    }
+
+} // anonymous namespace
+
+namespace Opm
+{
+
+    std::atomic<bool> PerformanceTrace::enabled_{true};
+
+    PerformanceTrace::PerformanceTrace()
+        : origin_(Clock::now())
+    {
+    }
+
+    PerformanceTrace& PerformanceTrace::instance()
+    {
+        static PerformanceTrace trace;
+        return trace;
+    }
+
+    PerformanceTrace::ThreadBuffer& PerformanceTrace::threadBuffer()
+    {
+        // The buffers are owned by the trace, such that the records of
+        // threads which have finished are kept.
+        thread_local ThreadBuffer* buffer = nullptr;
+        if (!buffer) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            buffers_.push_back(std::make_unique<ThreadBuffer>());
+            buffer = buffers_.back().get();
+#if _OPENMP
+            buffer->thread = omp_get_thread_num();
+#endif
+        }
+        return *buffer;
+    }
+
+    void PerformanceTrace::addEvent(const char* name, const std::string* detail,
+                                    Clock::time_point start, Clock::time_point end)
+    {
+        using std::chrono::duration_cast;
+        using std::chrono::microseconds;
+        const auto duration = end - start;
+
+        auto& buffer = threadBuffer();
+        auto& total = buffer.totals[name];
+        total.seconds += std::chrono::duration<double>(duration).count();
+        ++total.calls;
+        if (buffer.events.size() < maxEvents) {
+            buffer.events.push_back({name,
+                                     detail ? *detail : std::string{},
+                                     duration_cast<microseconds>(start - origin_).count(),
+                                     duration_cast<microseconds>(duration).count()});
+        }
+    }
+
+    void PerformanceTrace::count(const char* name, long increment)
+    {
+        threadBuffer().counters[name] += increment;
+    }
+
+    void PerformanceTrace::writeChromeTrace(const std::string& filename, int rank) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::ofstream os(filename);
+        if (!os) {
+            throw std::runtime_error("Could not open trace file " + filename);
+        }
+
+        os << "{\"traceEvents\":[\n";
+        bool first = true;
+        std::map<std::string, long> counters;
+        for (const auto& buffer : buffers_) {
+            for (const auto& event : buffer->events) {
+                const std::string name = event.detail.empty()
+                    ? std::string(event.name)
+                    : std::string(event.name) + ":" + event.detail;
+                os << (first ? "" : ",\n")
+                   << fmt::format(R"({{"name":"{}","ph":"X","ts":{},"dur":{},"pid":{},"tid":{}}})",
+                                  escapeJson(name), event.start_us, event.duration_us, rank, buffer->thread);
+                first = false;
+            }
+            for (const auto& [name, value] : buffer->counters) {
+                counters[name] += value;
+            }
+        }
+        for (const auto& [name, value] : counters) {
+            os << (first ? "" : ",\n")
+               << fmt::format(R"({{"name":"{}","ph":"C","ts":0,"pid":{},"args":{{"value":{}}}}})",
+                              escapeJson(name), rank, value);
+            first = false;
+        }
+        os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    std::string PerformanceTrace::imbalanceSummary(const Communication& comm) const
+    {
+        // Serialize the local totals as lines of "kind name value calls".
+        std::string local;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::map<std::string, Total> totals;
+            std::map<std::string, long> counters;
+            for (const auto& buffer : buffers_) {
+                for (const auto& [name, total] : buffer->totals) {
+                    auto& sum = totals[name];
+                    sum.seconds += total.seconds;
+                    sum.calls += total.calls;
+                }
+                for (const auto& [name, value] : buffer->counters) {
+                    counters[name] += value;
+                }
+            }
+            for (const auto& [name, total] : totals) {
+                local += fmt::format("T\t{}\t{}\t{}\n", name, total.seconds, total.calls);
+            }
+            for (const auto& [name, value] : counters) {
+                local += fmt::format("C\t{}\t{}\t1\n", name, value);
+            }
+        }
+
+        const int size = comm.size();
+        int localSize = local.size();
+        std::vector<int> sizes(size);
+        comm.gather(&localSize, sizes.data(), 1, 0);
+        std::vector<int> offsets(size + 1, 0);
+        std::partial_sum(sizes.begin(), sizes.end(), offsets.begin() + 1);
+        std::vector<char> all(comm.rank() == 0 ? std::max(offsets.back(), 1) : 1);
+        comm.gatherv(local.data(), localSize, all.data(), sizes.data(), offsets.data(), 0);
+
+        if (comm.rank() != 0) {
+            return {};
+        }
+
+        struct Entry
+        {
+            std::vector<double> values;
+            long calls = 0;
+        };
+        std::map<std::pair<char, std::string>, Entry> entries;
+        for (int rank = 0; rank < size; ++rank) {
+            std::istringstream is(std::string(all.data() + offsets[rank], sizes[rank]));
+            std::string line;
+            while (std::getline(is, line)) {
+                std::istringstream ls(line);
+                std::string kind, name;
+                double value = 0.0;
+                long calls = 0;
+                std::getline(ls, kind, '\t');
+                std::getline(ls, name, '\t');
+                ls >> value >> calls;
+                auto& entry = entries[{kind.front(), name}];
+                entry.values.resize(size, 0.0);
+                entry.values[rank] = value;
+                entry.calls += calls;
+            }
+        }
+
+        std::ostringstream os;
+        os << fmt::format("{:<40} {:>10} {:>12} {:>12} {:>12} {:>8}\n",
+                          "Timer/counter", "Calls", "Min", "Avg", "Max", "Max/Avg");
+        for (const auto& [key, entry] : entries) {
+            const auto [min, max] = std::minmax_element(entry.values.begin(), entry.values.end());
+            const double avg = std::accumulate(entry.values.begin(), entry.values.end(), 0.0) / size;
+            const std::string name = key.first == 'T' ? key.second + " [s]" : key.second;
+            os << fmt::format("{:<40} {:>10} {:>12.4g} {:>12.4g} {:>12.4g} {:>8.3f}\n",
+                              name, entry.calls, *min, avg, *max,
+                              avg > 0.0 ? *max / avg : 1.0);
+        }
+        return os.str();
+    }
+
+} // namespace Opm
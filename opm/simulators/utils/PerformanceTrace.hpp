@@ -0,0 +1,178 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PERFORMANCETRACE_HEADER_INCLUDED
+#define OPM_PERFORMANCETRACE_HEADER_INCLUDED
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// Scoped timers and counters for the hot paths of the simulator.
+///
+/// The macros below expand to nothing unless the code is compiled with
+/// OPM_ENABLE_PERFORMANCE_TRACE (CMake option of the same name). Compiled
+/// in, they cost a single check of PerformanceTrace::enabled() while
+/// tracing is switched off at run time.
+///
+/// Names must be string literals, they are stored by address. Scopes
+/// which are entered per well or per other object take the object name
+/// as a separate detail argument, which is only copied if tracing is on.
+#define OPM_TRACE_CONCAT_IMPL(a, b) a##b
+#define OPM_TRACE_CONCAT(a, b) OPM_TRACE_CONCAT_IMPL(a, b)
+
+#if OPM_ENABLE_PERFORMANCE_TRACE
+#define OPM_TRACE_SCOPE(name) \
+    ::Opm::PerformanceTrace::ScopedTimer OPM_TRACE_CONCAT(opm_trace_scope_, __LINE__)(name)
+#define OPM_TRACE_SCOPE_DETAIL(name, detail) \
+    ::Opm::PerformanceTrace::ScopedTimer OPM_TRACE_CONCAT(opm_trace_scope_, __LINE__)(name, &(detail))
+#define OPM_TRACE_COUNT(name, increment) \
+    do { \
+        if (::Opm::PerformanceTrace::enabled()) \
+            ::Opm::PerformanceTrace::instance().count(name, increment); \
+    } while (false)
+#else
+#define OPM_TRACE_SCOPE(name) do {} while (false)
+#define OPM_TRACE_SCOPE_DETAIL(name, detail) do {} while (false)
+#define OPM_TRACE_COUNT(name, increment) do {} while (false)
+#endif
+
+namespace Opm
+{
+
+    /// Process-wide collection of timed events and counters.
+    ///
+    /// Events are kept for export as a Chrome trace (chrome://tracing,
+    /// Perfetto), accumulated totals per event name and all counters are
+    /// also used for the rank imbalance summary. Every thread records into
+    /// its own buffer, only the first use in a thread takes a lock.
+    class PerformanceTrace
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Communication = Dune::CollectiveCommunication<Dune::MPIHelper::MPICommunicator>;
+
+        /// Records the time spent between construction and destruction.
+        class ScopedTimer
+        {
+        public:
+            explicit ScopedTimer(const char* name, const std::string* detail = nullptr)
+            {
+                if (PerformanceTrace::enabled()) {
+                    trace_ = &PerformanceTrace::instance();
+                    name_ = name;
+                    detail_ = detail;
+                    start_ = Clock::now();
+                }
+            }
+
+            ~ScopedTimer()
+            {
+                if (trace_) {
+                    trace_->addEvent(name_, detail_, start_, Clock::now());
+                }
+            }
+
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        private:
+            PerformanceTrace* trace_ = nullptr;
+            const char* name_ = nullptr;
+            const std::string* detail_ = nullptr;
+            Clock::time_point start_;
+        };
+
+        static PerformanceTrace& instance();
+
+        static bool enabled()
+        {
+            return enabled_.load(std::memory_order_relaxed);
+        }
+
+        static void setEnabled(bool enabled)
+        {
+            enabled_.store(enabled, std::memory_order_relaxed);
+        }
+
+        void addEvent(const char* name, const std::string* detail,
+                      Clock::time_point start, Clock::time_point end);
+        void count(const char* name, long increment = 1);
+
+        /// Write the recorded events of this process in Chrome trace JSON format.
+        /// Must not be called while other threads record events.
+        void writeChromeTrace(const std::string& filename, int rank) const;
+
+        /// Gather the totals of all processes and return a table with the
+        /// minimum, average and maximum over the processes of each timer
+        /// and counter. Collective, the result is only non-empty on rank 0.
+        /// Must not be called while other threads record events.
+        std::string imbalanceSummary(const Communication& comm) const;
+
+    private:
+        PerformanceTrace();
+
+        struct Event
+        {
+            const char* name;
+            std::string detail;
+            long long start_us;
+            long long duration_us;
+        };
+
+        struct Total
+        {
+            double seconds = 0.0;
+            long calls = 0;
+        };
+
+        // The records of one thread. Keyed by the address of the name
+        // literal, equal names from different translation units are merged
+        // when the records are written.
+        struct ThreadBuffer
+        {
+            int thread = 0;
+            std::vector<Event> events;
+            std::map<const char*, Total> totals;
+            std::map<const char*, long> counters;
+        };
+
+        ThreadBuffer& threadBuffer();
+
+        // Individual events beyond this per thread are only accumulated in
+        // the totals.
+        static constexpr std::size_t maxEvents = std::size_t(1) << 20;
+
+        static std::atomic<bool> enabled_;
+
+        mutable std::mutex mutex_;
+        Clock::time_point origin_;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+    };
+
+} // namespace Opm
+
+#endif // OPM_PERFORMANCETRACE_HEADER_INCLUDED
@@ -0,0 +1,189 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/simulators/utils/SimulatorCheckpoint.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/FileSystem.hpp>
+
+#include <opm/models/parallel/tasklets.hh>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQConfig.hpp>
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+namespace Opm {
+
+namespace {
+
+// Bump whenever the layout of the checkpoint files changes.
+constexpr std::uint64_t checkpointFormatVersion = 2;
+constexpr char checkpointMagic[] = "OPM_CHECKPOINT\n";
+
+template<class T>
+void writeValue(std::ostream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<class T>
+bool readValue(std::istream& is, T& value)
+{
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+} // anonymous namespace
+
+struct CheckpointWriteTasklet : public TaskletInterface
+{
+    std::string fileName_;
+    std::int64_t numProcs_;
+    std::int64_t reportStep_;
+    std::vector<char> buffer_;
+    std::string error_;
+
+    CheckpointWriteTasklet(const std::string& fileName,
+                           int numProcs,
+                           int reportStep,
+                           std::vector<char> buffer)
+        : fileName_(fileName)
+        , numProcs_(numProcs)
+        , reportStep_(reportStep)
+        , buffer_(std::move(buffer))
+    { }
+
+    void run() override
+    {
+        try {
+            const auto tmpFileName = fileName_ + ".tmp";
+            {
+                std::ofstream os(tmpFileName, std::ios::binary | std::ios::trunc);
+                os.write(checkpointMagic, sizeof(checkpointMagic) - 1);
+                writeValue(os, checkpointFormatVersion);
+                writeValue(os, numProcs_);
+                writeValue(os, reportStep_);
+                writeValue(os, static_cast<std::uint64_t>(buffer_.size()));
+                os.write(buffer_.data(), buffer_.size());
+                os.flush();
+                if (!os)
+                    throw std::runtime_error("Write failure");
+            }
+            filesystem::rename(tmpFileName, fileName_);
+        }
+        catch (const std::exception& e) {
+            error_ = e.what();
+        }
+        // release the memory while the simulation continues
+        std::vector<char>().swap(buffer_);
+    }
+};
+
+SimulatorCheckpoint::SimulatorCheckpoint(const std::string& outputDir,
+                                         const std::string& baseName,
+                                         int rank, int numProcs,
+                                         bool asyncWrite)
+    : fileName_((filesystem::path(outputDir) / fmt::format("{}.CHECKPOINT.{}", baseName, rank)).string())
+    , numProcs_(numProcs)
+    , taskletRunner_(std::make_unique<TaskletRunner>(asyncWrite ? 1 : 0))
+{
+}
+
+SimulatorCheckpoint::~SimulatorCheckpoint()
+{
+    wait();
+}
+
+void SimulatorCheckpoint::wait()
+{
+    taskletRunner_->barrier();
+    if (lastWrite_ && !lastWrite_->error_.empty())
+        OpmLog::warning(fmt::format("Could not write checkpoint '{}': {}",
+                                    fileName_, lastWrite_->error_));
+    lastWrite_.reset();
+}
+
+void SimulatorCheckpoint::write(int reportStep, std::vector<char> buffer)
+{
+    // at most one checkpoint is in flight, such that the file of the
+    // previous report step is complete before it is replaced
+    wait();
+    lastWrite_ = std::make_shared<CheckpointWriteTasklet>(fileName_, numProcs_,
+                                                          reportStep, std::move(buffer));
+    taskletRunner_->dispatch(lastWrite_);
+}
+
+std::vector<char> SimulatorCheckpoint::read(int& reportStep) const
+{
+    std::ifstream is(fileName_, std::ios::binary);
+    if (!is)
+        throw std::runtime_error(fmt::format("Could not open checkpoint '{}'", fileName_));
+
+    std::string magic(sizeof(checkpointMagic) - 1, '\0');
+    std::uint64_t version = 0;
+    std::int64_t numProcs = 0;
+    std::int64_t step = 0;
+    std::uint64_t size = 0;
+    if (!is.read(magic.data(), magic.size()) || magic != checkpointMagic ||
+        !readValue(is, version) || version != checkpointFormatVersion ||
+        !readValue(is, numProcs) || !readValue(is, step) || !readValue(is, size))
+        throw std::runtime_error(fmt::format("'{}' is not a checkpoint of this version", fileName_));
+
+    if (numProcs != numProcs_)
+        throw std::runtime_error(fmt::format("Checkpoint '{}' was written by {} processes, "
+                                             "it cannot be used with {} processes",
+                                             fileName_, numProcs, numProcs_));
+
+    std::vector<char> buffer(size);
+    if (!is.read(buffer.data(), size))
+        throw std::runtime_error(fmt::format("Checkpoint '{}' is truncated", fileName_));
+
+    reportStep = static_cast<int>(step);
+    return buffer;
+}
+
+std::string SimulatorCheckpoint::unsupportedKeywords(const Schedule& schedule)
+{
+    std::set<std::string> keywords;
+    for (std::size_t step = 0; step < schedule.size(); ++step) {
+        const auto& udq_config = schedule.getUDQConfig(step);
+        if (!udq_config.definitions().empty() || !udq_config.assignments().empty())
+            keywords.insert("UDQ");
+        if (!schedule[step].actions().empty())
+            keywords.insert("ACTIONX");
+        if (schedule[step].wtest_config().size() != 0)
+            keywords.insert("WTEST");
+        if (schedule[step].guide_rate().has_model())
+            keywords.insert("GUIDERAT");
+    }
+    std::string result;
+    for (const auto& keyword : keywords)
+        result += (result.empty() ? "" : ", ") + keyword;
+    return result;
+}
+
+} // end namespace Opm
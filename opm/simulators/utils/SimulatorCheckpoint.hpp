@@ -0,0 +1,86 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_SIMULATOR_CHECKPOINT_HPP
+#define OPM_SIMULATOR_CHECKPOINT_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class Schedule;
+class TaskletRunner;
+struct CheckpointWriteTasklet;
+
+/*! \brief Per process binary checkpoint files of the simulator state.
+ *! \details Each process writes the serialized state it owns to its own
+ *!          file, <outputDir>/<baseName>.CHECKPOINT.<rank>. A checkpoint
+ *!          can only be read by a run with the same number of processes.
+ *!          Files are written to a temporary name first and renamed when
+ *!          complete, such that a run killed while writing leaves the
+ *!          previous checkpoint intact.
+*/
+class SimulatorCheckpoint {
+public:
+    //! \brief Constructor.
+    //! \param asyncWrite Write the files from a separate thread
+    SimulatorCheckpoint(const std::string& outputDir,
+                        const std::string& baseName,
+                        int rank, int numProcs,
+                        bool asyncWrite);
+
+    //! \brief Waits for a pending write to complete.
+    ~SimulatorCheckpoint();
+
+    //! \brief Writes the state at the end of a report step.
+    //! \details Returns once the previous write has completed, the file
+    //!          itself is written asynchronously if enabled.
+    void write(int reportStep, std::vector<char> buffer);
+
+    //! \brief Waits for a pending write to complete.
+    void wait();
+
+    //! \brief Reads the checkpoint of this process.
+    //! \details Throws std::runtime_error if there is no readable
+    //!          checkpoint written by the same number of processes.
+    //! \param reportStep The report step the checkpoint was written at
+    std::vector<char> read(int& reportStep) const;
+
+    //! \brief Name of the checkpoint file of this process.
+    const std::string& fileName() const
+    { return fileName_; }
+
+    //! \brief Schedule keywords whose dynamic state is not part of a checkpoint.
+    //! \details The UDQ and ACTIONX states, the well test state of WTEST and
+    //!          the damped guide rates of GUIDERAT are kept by classes which
+    //!          cannot be serialized. Returns the keywords used by the
+    //!          schedule, separated by commas, or an empty string.
+    static std::string unsupportedKeywords(const Schedule& schedule);
+
+private:
+    std::string fileName_;
+    int numProcs_;
+    std::unique_ptr<TaskletRunner> taskletRunner_;
+    std::shared_ptr<CheckpointWriteTasklet> lastWrite_;
+};
+
+} // end namespace Opm
+
+#endif // OPM_SIMULATOR_CHECKPOINT_HPP
@@ -21,6 +21,7 @@
 #include "config.h"
 
 #include <opm/simulators/utils/gatherDeferredLogger.hpp>
+#include <opm/simulators/utils/PerformanceTrace.hpp>
 
 #if HAVE_MPI
 
@@ -107,6 +108,7 @@ namespace Opm
     /// combine (per-process) messages
     Opm::DeferredLogger gatherDeferredLogger(const Opm::DeferredLogger& local_deferredlogger)
     {
+        OPM_TRACE_SCOPE("deferred_logger_gather");
 
         int num_messages = local_deferredlogger.messages_.size();
 
@@ -56,6 +56,7 @@
 
 #include <opm/simulators/utils/ParallelEclipseState.hpp>
 #include <opm/simulators/utils/ParallelSerialization.hpp>
+#include <opm/simulators/utils/ParsedStateCache.hpp>
 
 #include <fmt/format.h>
 
@@ -188,7 +189,8 @@ void setupMessageLimiter(const Opm::MessageLimits msgLimits,  const std::string&
 void readDeck(int rank, std::string& deckFilename, std::unique_ptr<Opm::Deck>& deck, std::unique_ptr<Opm::EclipseState>& eclipseState,
               std::unique_ptr<Opm::Schedule>& schedule, std::unique_ptr<Opm::SummaryConfig>& summaryConfig,
               std::unique_ptr<ErrorGuard> errorGuard, std::shared_ptr<Opm::Python>& python, std::unique_ptr<ParseContext> parseContext,
-              bool initFromRestart, bool checkDeck, const std::optional<int>& outputInterval)
+              bool initFromRestart, bool checkDeck, const std::optional<int>& outputInterval,
+              const std::string& parsedStateCacheDir)
 {
     if (!errorGuard)
     {
@@ -206,11 +208,41 @@ void readDeck(int rank, std::string& deckFilename, std::unique_ptr<Opm::Deck>& d
                 OPM_THROW(std::logic_error, "We need a parse context if deck, schedule, or summaryConfig are not initialized");
             }
 
+#if HAVE_MPI
+            // The EclipseState is not cached as the grid and field properties
+            // are not serializable, it is rebuilt from the cached deck instead.
+            const bool useCache = !parsedStateCacheDir.empty() && !deck && !schedule && !summaryConfig;
+            bool cacheHit = false;
+            if (useCache)
+            {
+                deck = std::make_unique<Opm::Deck>();
+                schedule = std::make_unique<Opm::Schedule>(python);
+                summaryConfig = std::make_unique<Opm::SummaryConfig>();
+                cacheHit = loadParsedStateCache(parsedStateCacheDir, deckFilename,
+                                                *parseContext, initFromRestart,
+                                                *deck, *schedule, *summaryConfig);
+                if (!cacheHit) {
+                    deck.reset();
+                    schedule.reset();
+                    summaryConfig.reset();
+                }
+            }
+#else
+            (void) parsedStateCacheDir;
+#endif
+
+            // A deck from the cache is validated like a freshly parsed one,
+            // the validation depends on the settings of this run.
+            bool validateDeck = cacheHit;
+            Opm::Parser parser;
             if (!deck)
             {
-                Opm::Parser parser;
                 deck = std::make_unique<Opm::Deck>( parser.parseFile(deckFilename , *parseContext, *errorGuard));
+                validateDeck = true;
+            }
 
+            if (validateDeck)
+            {
                 Opm::KeywordValidation::KeywordValidator keyword_validator(
                     Opm::FlowKeywordValidation::unsupportedKeywords(),
                     Opm::FlowKeywordValidation::partiallySupported<std::string>(),
@@ -235,6 +267,14 @@ void readDeck(int rank, std::string& deckFilename, std::unique_ptr<Opm::Deck>& d
               included here as a switch.
             */
             const auto& init_config = eclipseState->getInitConfig();
+#if HAVE_MPI
+            // Never use a cached schedule when it is to be initialized from
+            // a restart file, such entries are not stored to begin with.
+            if (cacheHit && init_config.restartRequested() && initFromRestart) {
+                schedule.reset();
+                summaryConfig.reset();
+            }
+#endif
             if (init_config.restartRequested() && initFromRestart) {
                 const int report_step = init_config.getRestartStep();
                 const auto rst_filename = eclipseState->getIOConfig().getRestartFileName( init_config.getRestartRootName(), report_step, false );
@@ -257,6 +297,17 @@ void readDeck(int rank, std::string& deckFilename, std::unique_ptr<Opm::Deck>& d
                                                                      eclipseState->aquifer(), *parseContext, *errorGuard);
 
             Opm::checkConsistentArrayDimensions(*eclipseState, *schedule, *parseContext, *errorGuard);
+
+#if HAVE_MPI
+            // A schedule initialized from a restart file depends on more than the deck.
+            if (useCache && !cacheHit && !*errorGuard &&
+                !(init_config.restartRequested() && initFromRestart))
+            {
+                storeParsedStateCache(parsedStateCacheDir, deckFilename,
+                                      *parseContext, initFromRestart,
+                                      *deck, *schedule, *summaryConfig);
+            }
+#endif
         }
         catch(const OpmInputError& input_error) {
             failureMessage = input_error.what();
@@ -52,10 +52,14 @@ FileOutputMode setupLogging(int mpi_rank_, const std::string& deck_filename, con
 /// \brief Reads the deck and creates all necessary objects if needed
 ///
 /// If pointers already contains objects then they are used otherwise they are created and can be used outside later.
+/// If parsedStateCacheDir is non-empty the parsed deck, schedule and summary configuration are
+/// taken from a binary cache in that directory if it holds an entry for unchanged input files,
+/// and stored there otherwise.
 void readDeck(int rank, std::string& deckFilename, std::unique_ptr<Deck>& deck, std::unique_ptr<EclipseState>& eclipseState,
               std::unique_ptr<Schedule>& schedule, std::unique_ptr<SummaryConfig>& summaryConfig,
               std::unique_ptr<ErrorGuard> errorGuard, std::shared_ptr<Python>& python, std::unique_ptr<ParseContext> parseContext,
-              bool initFromRestart, bool checkDeck, const std::optional<int>& outputInterval);
+              bool initFromRestart, bool checkDeck, const std::optional<int>& outputInterval,
+              const std::string& parsedStateCacheDir = "");
 } // end namespace Opm
 
 #endif // OPM_READDECK_HEADER_INCLUDED
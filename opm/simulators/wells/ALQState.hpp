@@ -43,6 +43,15 @@ public:
     int  get_increment_count(const std::string& wname) const;
     int  get_decrement_count(const std::string& wname) const;
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(current_alq_);
+        serializer(default_alq_);
+        serializer(alq_increase_count_);
+        serializer(alq_decrease_count_);
+    }
+
 private:
     std::map<std::string, double> current_alq_;
     std::map<std::string, double> default_alq_;
@@ -64,6 +64,7 @@
 #include <opm/simulators/wells/StandardWell.hpp>
 #include <opm/simulators/wells/MultisegmentWell.hpp>
 #include <opm/simulators/wells/WellGroupHelpers.hpp>
+#include <opm/simulators/wells/WellHelpers.hpp>
 #include <opm/simulators/wells/WellProdIndexCalculator.hpp>
 #include <opm/simulators/wells/ParallelWellInfo.hpp>
 #include <opm/simulators/timestepping/gatherConvergenceReport.hpp>
@@ -256,6 +257,11 @@ namespace Opm {
 
             const SimulatorReportSingle& lastReport() const;
 
+            // accumulated assembly time of the wells over the run, each well's
+            // time is distributed evenly over its perforated local cells
+            const std::vector<double>& wellAssembleTimePerCell() const
+            { return well_assemble_time_per_cell_; }
+
             void addWellContributions(SparseMatrixAdapter& jacobian) const
             {
                 for ( const auto& well: well_container_ ) {
@@ -263,6 +269,22 @@ namespace Opm {
                 }
             }
 
+            // assemble the contributions of all wells into a separate matrix over the
+            // cells, e.g. to store them with a linear system that does not contain them
+            void assembleWellContributionMatrix(SparseMatrixAdapter& matrix) const
+            {
+                std::vector<NeighborSet> pattern(local_num_cells_);
+                for ( const auto& well: well_container_ ) {
+                    const auto& cells = well->cells();
+                    for (int cellIdx : cells) {
+                        pattern[cellIdx].insert(cells.begin(), cells.end());
+                    }
+                }
+                matrix.reserve(pattern);
+                matrix.clear();
+                addWellContributions(matrix);
+            }
+
             // called at the beginning of a report step
             void beginReportStep(const int time_step);
 
@@ -319,6 +341,8 @@ namespace Opm {
 
             SimulatorReportSingle last_report_{};
 
+            std::vector<double> well_assemble_time_per_cell_{};
+
             // used to better efficiency of calcuation
             mutable BVector scaleAddRes_{};
 
@@ -353,11 +377,20 @@ namespace Opm {
             void updateAverageFormationFactor();
 
             void computePotentials(const std::size_t widx,
-                                   const WellState& well_state_copy,
+                                   WellState& well_state_copy,
+                                   std::vector<double>& potentials,
                                    std::string& exc_msg,
                                    ExceptionType::ExcEnum& exc_type,
                                    DeferredLogger& deferred_logger) override;
 
+            // the inputs of the potential computation of a well which are checked
+            // before reusing its previous potentials. Both are empty if the
+            // potentials of the well are not to be reused.
+            void wellPotentialInputs(const WellInterface<TypeTag>& well,
+                                     const WellState& well_state,
+                                     std::vector<double>& inputs,
+                                     std::vector<double>& controls) const;
+
             const std::vector<double>& wellPerfEfficiencyFactors() const;
 
             void calculateProductivityIndexValuesShutWells(const int reportStepIdx, DeferredLogger& deferred_logger) override;
@@ -372,6 +405,15 @@ namespace Opm {
 
             void assembleWellEq(const double dt, DeferredLogger& deferred_logger);
 
+            // Calls func(widx, deferred_logger) for all wells in the well container.
+            // The wells local to this process are processed concurrently, each with
+            // its own logger, followed by the distributed wells in order. Messages
+            // are merged and the first exception is rethrown in well order, such
+            // that the outcome does not depend on the number of threads.
+            template <class Func>
+            void forEachWell_(Func&& func, DeferredLogger& deferred_logger) const;
+
+
             void maybeDoGasLiftOptimize(DeferredLogger& deferred_logger);
 
             bool checkDoGasLiftOptimization(DeferredLogger& deferred_logger);
@@ -32,16 +32,26 @@
 #include <opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 
 #include <opm/simulators/utils/DeferredLogger.hpp>
+#include <opm/simulators/utils/PerformanceTrace.hpp>
 #include <opm/simulators/wells/GasLiftStage2.hpp>
 #include <opm/simulators/wells/VFPProperties.hpp>
 #include <opm/simulators/wells/WellGroupHelpers.hpp>
 #include <opm/simulators/wells/WellState.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 
 #include <fmt/format.h>
 
+#if HAVE_MPI
+#include <mpi.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Opm {
 
 BlackoilWellModelGeneric::
@@ -262,6 +272,7 @@ initFromRestartFile(const RestartValue& restartValues,
     // will not be present in a restart file. Use the previous time step to retrieve
     // wells that have information written to the restart file.
     const int report_step = std::max(eclState_.getInitConfig().getRestartStep() - 1, 0);
+    this->activeWGStateModified();
     // wells_ecl_ should only contain wells on this processor.
     wells_ecl_ = getLocalWells(report_step);
     local_parallel_well_info_ = createLocalParallelWellInfo(wells_ecl_);
@@ -1031,6 +1042,7 @@ BlackoilWellModelGeneric::
 updateEclWells(const int timeStepIdx,
                const std::unordered_set<std::string>& wells)
 {
+    this->activeWGStateModified();
     for (const auto& wname : wells) {
         auto well_iter = std::find_if( this->wells_ecl_.begin(), this->wells_ecl_.end(), [wname] (const auto& well) -> bool { return well.name() == wname;});
         if (well_iter != this->wells_ecl_.end()) {
@@ -1532,8 +1544,11 @@ updateAndCommunicateGroupData(const int reportStepIdx,
         }
     }
 
-    well_state.communicateGroupRates(comm_);
-    this->groupState().communicate_rates(comm_);
+    {
+        OPM_TRACE_SCOPE("well_group_communication");
+        well_state.communicateGroupRates(comm_);
+        this->groupState().communicate_rates(comm_);
+    }
     // compute wsolvent fraction for REIN wells
     updateWsolvent(fieldGroup, reportStepIdx,  well_state_nupcol);
 }
@@ -1551,6 +1566,26 @@ hasTHPConstraints() const
     return comm_.max(local_result);
 }
 
+bool
+BlackoilWellModelGeneric::
+hasClosedWellsOrCompletions() const
+{
+    int closed = 0;
+    for (const auto& well : wells_ecl_) {
+        if (wellTestState_.hasWellClosed(well.name())) {
+            closed = 1;
+            break;
+        }
+        for (const auto& connection : well.getConnections()) {
+            if (wellTestState_.hasCompletion(well.name(), connection.complnum())) {
+                closed = 1;
+                break;
+            }
+        }
+    }
+    return comm_.max(closed) != 0;
+}
+
 bool
 BlackoilWellModelGeneric::
 forceShutWellByNameIfPredictionMode(const std::string& wellname,
@@ -1740,6 +1775,8 @@ updateWellPotentials(const int reportStepIdx,
     const bool write_restart_file = schedule().write_rst_file(reportStepIdx);
     auto exc_type = ExceptionType::NONE;
     std::string exc_msg;
+    std::vector<std::size_t> local_wells;
+    std::vector<std::size_t> distributed_wells;
     size_t widx = 0;
     for (const auto& well : well_container_generic_) {
         const bool needed_for_summary =
@@ -1778,18 +1815,99 @@ updateWellPotentials(const int reportStepIdx,
         const bool needPotentialsForGuideRates = well->underPredictionMode() && (!onlyAfterEvent || event);
         const bool needPotentialsForOutput = !onlyAfterEvent && (needed_for_summary || write_restart_file);
         const bool compute_potential = needPotentialsForOutput || needPotentialsForGuideRates;
+        // events like changed connections invalidate the memo, also if the
+        // potentials are not computed now, as the event is only seen once
+        if (event)
+            well_potential_memo_.erase(well->name());
         if (compute_potential)
         {
-            this->computePotentials(widx, well_state_copy, exc_msg, exc_type, deferred_logger);
+            // created here such that the map is not modified concurrently
+            well_potential_memo_[well->name()];
+
+            if (well->parallelWellInfo().communication().size() > 1)
+                distributed_wells.push_back(widx);
+            else
+                local_wells.push_back(widx);
         }
         ++widx;
     }
+
+    // The wells completely on this process are independent of each other
+    // and computed concurrently, each thread with its own copy of the well
+    // state. Distributed wells communicate and are computed in order.
+    std::vector<std::vector<double>> potentials(well_container_generic_.size());
+    const int num_threads = numLocalWellThreads(local_wells.size());
+    if (num_threads > 1) {
+#ifdef _OPENMP
+        std::vector<DeferredLogger> thread_loggers(num_threads);
+        std::vector<ExceptionType::ExcEnum> thread_exc_types(num_threads, ExceptionType::NONE);
+        std::vector<std::string> thread_exc_msgs(num_threads);
+#pragma omp parallel num_threads(num_threads)
+        {
+            const int thread = omp_get_thread_num();
+            WellState thread_well_state = well_state_copy;
+#pragma omp for schedule(dynamic)
+            for (std::size_t i = 0; i < local_wells.size(); ++i) {
+                this->computePotentials(local_wells[i], thread_well_state, potentials[local_wells[i]],
+                                        thread_exc_msgs[thread], thread_exc_types[thread],
+                                        thread_loggers[thread]);
+            }
+        }
+        for (int thread = 0; thread < num_threads; ++thread) {
+            deferred_logger.append(thread_loggers[thread]);
+            if (thread_exc_types[thread] > exc_type) {
+                exc_type = thread_exc_types[thread];
+                exc_msg = thread_exc_msgs[thread];
+            }
+        }
+#endif
+    } else {
+        for (const auto widx : local_wells)
+            this->computePotentials(widx, well_state_copy, potentials[widx], exc_msg, exc_type, deferred_logger);
+    }
+    for (const auto widx : distributed_wells)
+        this->computePotentials(widx, well_state_copy, potentials[widx], exc_msg, exc_type, deferred_logger);
+
+    // Store them in the well state. The potentials are zero for wells where
+    // the computation failed.
+    const int np = this->numPhases();
+    for (const auto& well_indices : {local_wells, distributed_wells}) {
+        for (const auto widx : well_indices) {
+            auto& well_potentials = potentials[widx];
+            well_potentials.resize(np, 0.0);
+            const int well_index = well_container_generic_[widx]->indexOfWell();
+            for (int p = 0; p < np; ++p)
+                this->wellState().wellPotentials(well_index)[p] = std::abs(well_potentials[p]);
+        }
+    }
+
     logAndCheckForExceptionsAndThrow(deferred_logger, exc_type,
                                      "computeWellPotentials() failed: " + exc_msg,
                                      terminal_output_);
 
 }
 
+int
+BlackoilWellModelGeneric::
+numLocalWellThreads([[maybe_unused]] std::size_t num_wells)
+{
+#ifdef _OPENMP
+#if HAVE_MPI
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    if (initialized) {
+        int provided = MPI_THREAD_SINGLE;
+        MPI_Query_thread(&provided);
+        if (provided != MPI_THREAD_MULTIPLE)
+            return 1;
+    }
+#endif
+    return std::min(omp_get_max_threads(), static_cast<int>(num_wells));
+#else
+    return 1;
+#endif
+}
+
 void
 BlackoilWellModelGeneric::
 runWellPIScaling(const int timeStepIdx,
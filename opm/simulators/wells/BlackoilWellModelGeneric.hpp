@@ -114,7 +114,10 @@ public:
         return this->active_wgstate_.well_state;
     }
 
-    GroupState& groupState() { return this->active_wgstate_.group_state; }
+    GroupState& groupState()
+    {
+        return this->active_wgstate_.group_state;
+    }
 
 
     double wellPI(const int well_index) const;
@@ -144,7 +147,9 @@ public:
     */
     void commitWGState()
     {
-        this->last_valid_wgstate_ = this->active_wgstate_;
+        if (!this->active_wgstate_is_last_valid_)
+            this->last_valid_wgstate_ = this->active_wgstate_;
+        this->active_wgstate_is_last_valid_ = true;
     }
 
     data::GroupAndNetworkValues groupAndNetworkData(const int reportStepIdx) const;
@@ -152,11 +157,36 @@ public:
     /// Return true if any well has a THP constraint.
     bool hasTHPConstraints() const;
 
+    /// Return true if a well or completion of any process is closed in
+    /// the well test state. Collective.
+    bool hasClosedWellsOrCompletions() const;
+
     /// Shut down any single well, but only if it is in prediction mode.
     /// Returns true if the well was actually found and shut.
     bool forceShutWellByNameIfPredictionMode(const std::string& wellname,
                                              const double simulation_time);
 
+    /// The dynamic state of the well model at the end of a report step,
+    /// for checkpointing. Only the last valid well and group state is
+    /// stored, the active and NUPCOL states are restored as copies of it.
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        this->last_valid_wgstate_.serializeOp(serializer);
+        if (!serializer.isSerializing()) {
+            this->active_wgstate_is_last_valid_ = false;
+            this->last_run_wellpi_.reset();
+        }
+        serializer(this->last_run_wellpi_);
+        serializer(this->node_pressures_);
+
+        if (!serializer.isSerializing()) {
+            this->resetWGState();
+            this->updateNupcolWGState();
+            this->initial_step_ = false;
+        }
+    }
+
 protected:
 
     /*
@@ -213,6 +243,7 @@ protected:
     void commitWGState(WGState wgstate)
     {
         this->last_valid_wgstate_ = std::move(wgstate);
+        this->active_wgstate_is_last_valid_ = false;
     }
 
     /*
@@ -222,7 +253,21 @@ protected:
     */
     void resetWGState()
     {
-        this->active_wgstate_ = this->last_valid_wgstate_;
+        if (!this->active_wgstate_is_last_valid_)
+            this->active_wgstate_ = this->last_valid_wgstate_;
+        this->active_wgstate_is_last_valid_ = true;
+    }
+
+    /*
+      Must be called before the active wellstate is modified after a
+      commitWGState() or resetWGState(), such that the next commit or reset
+      copies the state again. Within a time step this is done by
+      beginTimeStep(), outside of time steps by the functions modifying
+      the active state.
+    */
+    void activeWGStateModified()
+    {
+        this->active_wgstate_is_last_valid_ = false;
     }
 
     /*
@@ -346,8 +391,17 @@ protected:
                                    GLiftWellStateMap& map,
                                    const int episodeIndex);
 
+    // Number of threads used for loops over the wells which are local to this
+    // process. The well computations still call into MPI on the communicator
+    // of the well, hence threads are only used if MPI supports concurrent calls.
+    static int numLocalWellThreads(std::size_t num_wells);
+
+    // Computes the potentials of a well. well_state_copy is a copy of the
+    // well state, the entries of the well are reset after the computation.
+    // Must be safe to call concurrently for wells on a single process.
     virtual void computePotentials(const std::size_t widx,
-                                   const WellState& well_state_copy,
+                                   WellState& well_state_copy,
+                                   std::vector<double>& potentials,
                                    std::string& exc_msg,
                                    ExceptionType::ExcEnum& exc_type,
                                    DeferredLogger& deferred_logger) = 0;
@@ -410,6 +464,17 @@ protected:
     std::unique_ptr<VFPProperties> vfp_properties_{};
     std::map<std::string, double> node_pressures_; // Storing network pressures for output.
 
+    // Inputs and result of the last potential computation of each well, the
+    // potentials are reused as long as the inputs do not change beyond the
+    // tolerance, see BlackoilWellModel::computePotentials().
+    struct WellPotentialMemo
+    {
+        std::vector<double> inputs;
+        std::vector<double> controls;
+        std::vector<double> potentials;
+    };
+    std::map<std::string, WellPotentialMemo> well_potential_memo_;
+
     /*
       The various wellState members should be accessed and modified
       through the accessor functions wellState(), prevWellState(),
@@ -420,6 +485,13 @@ protected:
     WGState last_valid_wgstate_;
     WGState nupcol_wgstate_;
 
+    // True while the active state is known to equal the last valid state,
+    // i.e. after commitWGState() or resetWGState() until the next call to
+    // activeWGStateModified(). Saves the copy of the common sequence of a
+    // commit at the end of a time step and a reset at the beginning of the
+    // next one.
+    bool active_wgstate_is_last_valid_ = false;
+
     bool glift_debug = false;
 
   private:
@@ -21,6 +21,7 @@
 */
 
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
+#include <opm/simulators/utils/PerformanceTrace.hpp>
 #include <opm/core/props/phaseUsageFromDeck.hpp>
 
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
@@ -28,10 +29,16 @@
 #include <opm/simulators/wells/VFPProperties.hpp>
 
 #include <algorithm>
+#include <exception>
+#include <iterator>
 #include <utility>
 
 #include <fmt/format.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Opm {
     template<typename TypeTag>
     BlackoilWellModel<TypeTag>::
@@ -135,9 +142,17 @@ namespace Opm {
                 }
             }
 
+            // With the cells in ascending order every element is inserted
+            // with a hint, and each cell is only visited once even if it
+            // has several connections.
+            std::sort(wellCells.begin(), wellCells.end());
+            wellCells.erase(std::unique(wellCells.begin(), wellCells.end()), wellCells.end());
             for (int cellIdx : wellCells) {
-                neighbors[cellIdx].insert(wellCells.begin(),
-                                          wellCells.end());
+                auto& cellNeighbors = neighbors[cellIdx];
+                auto hint = cellNeighbors.begin();
+                for (int otherIdx : wellCells) {
+                    hint = std::next(cellNeighbors.insert(hint, otherIdx));
+                }
             }
         }
     }
@@ -177,6 +192,7 @@ namespace Opm {
     {
         DeferredLogger local_deferredLogger;
         report_step_starts_ = true;
+        this->activeWGStateModified();
 
         const Grid& grid = ebosSimulator_.vanguard().grid();
         const auto& summaryState = ebosSimulator_.vanguard().summaryState();
@@ -234,6 +250,9 @@ namespace Opm {
         DeferredLogger local_deferredLogger;
 
         this->resetWGState();
+        // the active state is modified from here until it is committed in
+        // timeStepSucceeded() or reset by the next attempt of the step
+        this->activeWGStateModified();
         const int reportStepIdx = ebosSimulator_.episodeIndex();
         updateAndCommunicateGroupData(reportStepIdx,
                                       ebosSimulator_.model().newtonMethod().numIterations());
@@ -477,15 +496,16 @@ namespace Opm {
 
         this->calculateProductivityIndexValues(local_deferredLogger);
 
+        //reporting output temperatures
+        this->computeWellTemperature();
+
+        // after the last modification of the well state in this time step
         this->commitWGState();
 
         DeferredLogger global_deferredLogger = gatherDeferredLogger(local_deferredLogger);
         if (terminal_output_) {
             global_deferredLogger.logMessages();
         }
-
-        //reporting output temperatures
-        this->computeWellTemperature();
     }
 
 
@@ -856,6 +876,7 @@ namespace Opm {
     maybeDoGasLiftOptimize(DeferredLogger& deferred_logger)
     {
         if (checkDoGasLiftOptimization(deferred_logger)) {
+            OPM_TRACE_SCOPE("gas_lift_optimize");
             GLiftOptWells glift_wells;
             GLiftProdWells prod_wells;
             GLiftWellStateMap state_map;
@@ -1022,9 +1043,73 @@ namespace Opm {
     BlackoilWellModel<TypeTag>::
     assembleWellEq(const double dt, DeferredLogger& deferred_logger)
     {
-        for (auto& well : well_container_) {
-            well->assembleWellEq(ebosSimulator_, dt, this->wellState(), this->groupState(), deferred_logger);
+        OPM_TRACE_SCOPE("well_assemble");
+        // the states are fetched once, the accessors are not called from the threads
+        auto& well_state = this->wellState();
+        const auto& group_state = this->groupState();
+        std::vector<double> well_times(well_container_.size(), 0.0);
+        forEachWell_([this, dt, &well_state, &group_state, &well_times](const std::size_t widx, DeferredLogger& well_logger)
+        {
+            auto& well = well_container_[widx];
+            OPM_TRACE_SCOPE_DETAIL("well_assemble_well", well->name());
+            Dune::Timer wellTimer;
+            wellTimer.start();
+            well->assembleWellEq(ebosSimulator_, dt, well_state, group_state, well_logger);
+            well_times[widx] = wellTimer.stop();
+        }, deferred_logger);
+
+        well_assemble_time_per_cell_.resize(local_num_cells_, 0.0);
+        for (std::size_t widx = 0; widx < well_container_.size(); ++widx) {
+            const auto& cells = well_container_[widx]->cells();
+            for (const int cell : cells) {
+                well_assemble_time_per_cell_[cell] += well_times[widx] / cells.size();
+            }
+        }
+    }
+
+    template<typename TypeTag>
+    template <class Func>
+    void
+    BlackoilWellModel<TypeTag>::
+    forEachWell_(Func&& func, DeferredLogger& deferred_logger) const
+    {
+        std::vector<std::size_t> local_wells;
+        std::vector<std::size_t> distributed_wells;
+        for (std::size_t widx = 0; widx < well_container_.size(); ++widx) {
+            if (well_container_[widx]->parallelWellInfo().communication().size() > 1)
+                distributed_wells.push_back(widx);
+            else
+                local_wells.push_back(widx);
+        }
+
+        const int num_threads = numLocalWellThreads(local_wells.size());
+        if (num_threads > 1) {
+#ifdef _OPENMP
+            std::vector<DeferredLogger> well_loggers(local_wells.size());
+            std::vector<std::exception_ptr> well_exceptions(local_wells.size());
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+            for (std::size_t i = 0; i < local_wells.size(); ++i) {
+                try {
+                    func(local_wells[i], well_loggers[i]);
+                } catch (...) {
+                    well_exceptions[i] = std::current_exception();
+                }
+            }
+            for (auto& well_logger : well_loggers)
+                deferred_logger.append(well_logger);
+            for (const auto& exception : well_exceptions) {
+                if (exception)
+                    std::rethrow_exception(exception);
+            }
+#endif
+        } else {
+            for (const auto widx : local_wells)
+                func(widx, deferred_logger);
         }
+
+        // distributed wells communicate, they are processed in the same order on all processes
+        for (const auto widx : distributed_wells)
+            func(widx, deferred_logger);
     }
 
     template<typename TypeTag>
@@ -1133,9 +1218,11 @@ namespace Opm {
         std::string exc_msg;
         try {
             if (localWellsActive()) {
-                for (auto& well : well_container_) {
-                    well->recoverWellSolutionAndUpdateWellState(x, this->wellState(), local_deferredLogger);
-                }
+                auto& well_state = this->wellState();
+                forEachWell_([this, &x, &well_state](const std::size_t widx, DeferredLogger& well_logger)
+                {
+                    well_container_[widx]->recoverWellSolutionAndUpdateWellState(x, well_state, well_logger);
+                }, local_deferredLogger);
             }
         } catch (const std::runtime_error& e) {
             exc_type = ExceptionType::RUNTIME_ERROR;
@@ -1179,11 +1266,19 @@ namespace Opm {
 
         DeferredLogger local_deferredLogger;
         // Get global (from all processes) convergence report.
-        ConvergenceReport local_report;
-        for (const auto& well : well_container_) {
+        // the reports are combined in well order
+        std::vector<ConvergenceReport> well_reports(well_container_.size());
+        const auto& well_state = this->wellState();
+        forEachWell_([this, &B_avg, &well_reports, &well_state](const std::size_t widx, DeferredLogger& well_logger)
+        {
+            const auto& well = well_container_[widx];
             if (well->isOperable() ) {
-                local_report += well->getWellConvergence(this->wellState(), B_avg, local_deferredLogger);
+                well_reports[widx] = well->getWellConvergence(well_state, B_avg, well_logger);
             }
+        }, local_deferredLogger);
+        ConvergenceReport local_report;
+        for (const auto& well_report : well_reports) {
+            local_report += well_report;
         }
         DeferredLogger global_deferredLogger = gatherDeferredLogger(local_deferredLogger);
         if (terminal_output_) {
@@ -1315,16 +1410,35 @@ namespace Opm {
     template<typename TypeTag>
     void
     BlackoilWellModel<TypeTag>::computePotentials(const std::size_t widx,
-                                                  const WellState& well_state_copy,
+                                                  WellState& well_state_copy,
+                                                  std::vector<double>& potentials,
                                                   std::string& exc_msg,
                                                   ExceptionType::ExcEnum& exc_type,
                                                   DeferredLogger& deferred_logger)
     {
-        const int np = numPhases();
-        std::vector<double> potentials;
         const auto& well= well_container_[widx];
+        OPM_TRACE_SCOPE("well_potentials");
+
+        auto& memo = this->well_potential_memo_.at(well->name());
         try {
+            // reuse the previous potentials if the controls are the same and
+            // none of the inputs changed by more than the tolerance
+            std::vector<double> inputs;
+            std::vector<double> controls;
+            wellPotentialInputs(*well, well_state_copy, inputs, controls);
+            if (!controls.empty() && memo.controls == controls &&
+                wellhelpers::withinRelativeTolerance(inputs, memo.inputs,
+                                                     param_.well_potential_reuse_tolerance_))
+            {
+                potentials = memo.potentials;
+                return;
+            }
+            memo = {};
+
             well->computeWellPotentials(ebosSimulator_, well_state_copy, potentials, deferred_logger);
+            if (!controls.empty()) {
+                memo = {std::move(inputs), std::move(controls), potentials};
+            }
         } catch (const std::runtime_error& e) {
             exc_type = ExceptionType::RUNTIME_ERROR;
             exc_msg = e.what();
@@ -1338,12 +1452,92 @@ namespace Opm {
             exc_type = ExceptionType::DEFAULT;
             exc_msg = e.what();
         }
-        // Store it in the well state
         // potentials is resized and set to zero in the beginning of well->ComputeWellPotentials
         // and updated only if sucessfull. i.e. the potentials are zero for exceptions
-        for (int p = 0; p < np; ++p) {
-            this->wellState().wellPotentials(well->indexOfWell())[p] = std::abs(potentials[p]);
+
+        // leave the copy of the well state as it was for the next well, this
+        // runs in threads and only reads the active state
+        well_state_copy.copyWellData(std::as_const(*this).wellState(), well->indexOfWell());
+    }
+
+
+
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::wellPotentialInputs(const WellInterface<TypeTag>& well,
+                                                    const WellState& well_state,
+                                                    std::vector<double>& inputs,
+                                                    std::vector<double>& controls) const
+    {
+        inputs.clear();
+        controls.clear();
+
+        // The potentials of pressure controlled wells are their current rates,
+        // which are cheap to get and not memoized.
+        const int well_index = well.indexOfWell();
+        const auto& summary_state = ebosSimulator_.vanguard().summaryState();
+        if (well.isInjector()) {
+            const auto cmode = well_state.currentInjectionControl(well_index);
+            if (cmode == Well::InjectorCMode::BHP || cmode == Well::InjectorCMode::THP) {
+                return;
+            }
+            const auto inj_controls = well.wellEcl().injectionControls(summary_state);
+            controls = {static_cast<double>(static_cast<int>(cmode)), inj_controls.bhp_limit, inj_controls.thp_limit,
+                        static_cast<double>(inj_controls.vfp_table_number)};
+        } else {
+            const auto cmode = well_state.currentProductionControl(well_index);
+            if (cmode == Well::ProducerCMode::BHP || cmode == Well::ProducerCMode::THP) {
+                return;
+            }
+            const auto prod_controls = well.wellEcl().productionControls(summary_state);
+            controls = {static_cast<double>(static_cast<int>(cmode)), prod_controls.bhp_limit, prod_controls.thp_limit,
+                        static_cast<double>(prod_controls.vfp_table_number), well.getALQ(well_state)};
+        }
+        controls.push_back(well.wellIsStopped() ? 1.0 : 0.0);
+        // the connection transmissibility factors including the productivity
+        // index multipliers, changed by e.g. COMPDAT, WELPI or WPIMULT
+        const auto& connection_factors = well.wellIndex();
+        controls.insert(controls.end(), connection_factors.begin(), connection_factors.end());
+
+        // the states of the connection cells
+        for (const int cell_idx : well.cells()) {
+            const auto* intQuants = ebosSimulator_.model().cachedIntensiveQuantities(cell_idx, /*timeIdx=*/0);
+            if (!intQuants) {
+                // without cached quantities there is nothing to compare with
+                controls.clear();
+                inputs.clear();
+                return;
+            }
+            const auto& fs = intQuants->fluidState();
+            for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx) {
+                if (!FluidSystem::phaseIsActive(phaseIdx)) {
+                    continue;
+                }
+                inputs.push_back(fs.pressure(phaseIdx).value());
+                inputs.push_back(fs.saturation(phaseIdx).value());
+                inputs.push_back(fs.invB(phaseIdx).value());
+                inputs.push_back(intQuants->mobility(phaseIdx).value());
+            }
+            inputs.push_back(fs.Rs().value());
+            inputs.push_back(fs.Rv().value());
+            inputs.push_back(fs.temperature(/*phaseIdx=*/0).value());
+            if constexpr (has_solvent_) {
+                inputs.push_back(intQuants->solventSaturation().value());
+            }
+            if constexpr (has_polymer_) {
+                inputs.push_back(intQuants->polymerConcentration().value());
+            }
+        }
+
+        // the pressure drops between the bhp and the connections, and the
+        // rates the computation starts from
+        const auto& perf_data = well_state.perfData(well_index);
+        const double bhp = well_state.bhp(well_index);
+        for (const double perf_pressure : perf_data.pressure) {
+            inputs.push_back(perf_pressure - bhp);
         }
+        const auto& well_rates = well_state.wellRates(well_index);
+        inputs.insert(inputs.end(), well_rates.begin(), well_rates.end());
     }
 
 
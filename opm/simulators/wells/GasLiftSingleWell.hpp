@@ -70,6 +70,7 @@ namespace Opm
 
         const Simulator &ebos_simulator_;
         const StdWell &std_well_;
+        ResponseCurve *response_curve_;
     };
 
 } // namespace Opm
@@ -25,13 +25,16 @@
 
 #include <opm/simulators/utils/DeferredLogger.hpp>
 #include <opm/simulators/wells/GasLiftWellState.hpp>
+#include <opm/simulators/wells/WellHelpers.hpp>
 #include <opm/simulators/wells/WellState.hpp>
 #include <opm/simulators/wells/GroupState.hpp>
 
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <sstream>
 
 namespace Opm
@@ -1380,5 +1383,67 @@ updateGroupRates(double delta_oil, double delta_gas, double delta_alq)
     }
 }
 
+/****************************************
+ * Methods declared in ResponseCurve
+ ****************************************/
+
+bool
+GasLiftSingleWellGeneric::ResponseCurve::
+matches(const std::vector<double>& cell_state,
+        const std::vector<double>& controls,
+        double tolerance) const
+{
+    return this->controls_ == controls
+        && wellhelpers::withinRelativeTolerance(cell_state, this->cell_state_, tolerance);
+}
+
+void
+GasLiftSingleWellGeneric::ResponseCurve::
+reset(std::vector<double> cell_state, std::vector<double> controls)
+{
+    this->cell_state_ = std::move(cell_state);
+    this->controls_ = std::move(controls);
+    this->bhp_at_alq_.clear();
+    this->rates_at_bhp_.clear();
+}
+
+bool
+GasLiftSingleWellGeneric::ResponseCurve::
+findBhp(double alq, std::optional<double>& bhp) const
+{
+    // NOTE: ALQ values reached by adding and subtracting increments in a
+    //   different order may differ by round off
+    const double epsilon = ALQ_EPSILON * std::max(std::abs(alq), 1.0);
+    auto it = this->bhp_at_alq_.lower_bound(alq - epsilon);
+    if (it == this->bhp_at_alq_.end() || it->first > alq + epsilon)
+        return false;
+    bhp = it->second;
+    return true;
+}
+
+bool
+GasLiftSingleWellGeneric::ResponseCurve::
+findRates(double bhp, std::vector<double>& potentials) const
+{
+    auto it = this->rates_at_bhp_.find(bhp);
+    if (it == this->rates_at_bhp_.end())
+        return false;
+    potentials = it->second;
+    return true;
+}
+
+void
+GasLiftSingleWellGeneric::ResponseCurve::
+insertBhp(double alq, const std::optional<double>& bhp)
+{
+    this->bhp_at_alq_.emplace(alq, bhp);
+}
+
+void
+GasLiftSingleWellGeneric::ResponseCurve::
+insertRates(double bhp, const std::vector<double>& potentials)
+{
+    this->rates_at_bhp_.emplace(bhp, potentials);
+}
 
 } // namespace Opm
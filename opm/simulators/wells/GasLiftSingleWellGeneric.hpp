@@ -30,6 +30,7 @@
 #include <opm/simulators/wells/GasLiftGroupInfo.hpp>
 
 #include <functional>
+#include <map>
 #include <optional>
 #include <string>
 #include <tuple>
@@ -80,6 +81,32 @@ public:
         bool alq_is_limited;
     };
 
+    // The bhp at the thp limit for given ALQ values and the well rates for
+    //   given bhp values, computed during the optimization of a well. The
+    //   curve is kept by the well and reused by later optimizations as long
+    //   as the controls and the states of the connection cells are unchanged.
+    class ResponseCurve
+    {
+    public:
+        bool matches(const std::vector<double>& cell_state,
+                     const std::vector<double>& controls,
+                     double tolerance) const;
+        void reset(std::vector<double> cell_state, std::vector<double> controls);
+
+        // NOTE: A cached bhp value of nullopt means that no bhp could be
+        //   obtained at the thp limit for this ALQ.
+        bool findBhp(double alq, std::optional<double>& bhp) const;
+        bool findRates(double bhp, std::vector<double>& potentials) const;
+        void insertBhp(double alq, const std::optional<double>& bhp);
+        void insertRates(double bhp, const std::vector<double>& potentials);
+
+    private:
+        std::vector<double> cell_state_;
+        std::vector<double> controls_;
+        std::map<double, std::optional<double>> bhp_at_alq_;
+        std::map<double, std::vector<double>> rates_at_bhp_;
+    };
+
     virtual ~GasLiftSingleWellGeneric() = default;
 
     const std::string& name() const { return well_name_; }
@@ -45,6 +45,7 @@ GasLiftSingleWell(const StdWell &std_well,
     )
    , ebos_simulator_{ebos_simulator}
    , std_well_{std_well}
+   , response_curve_{nullptr}
 {
     const auto& gl_well = *gl_well_;
     if(useFixedAlq_(gl_well)) {
@@ -87,6 +88,8 @@ GasLiftSingleWell(const StdWell &std_well,
         // TODO: adhoc value.. Should we keep max_iterations_ as a safety measure
         //   or does it not make sense to have it?
         this->max_iterations_ = 1000;
+
+        this->response_curve_ = std_well_.gasLiftResponseCurve(ebos_simulator_);
     }
 }
 
@@ -100,11 +103,16 @@ GasLiftSingleWell<TypeTag>::
 computeWellRates_(
     double bhp, std::vector<double> &potentials, bool debug_output) const
 {
-    // NOTE: If we do not clear the potentials here, it will accumulate
-    //   the new potentials to the old values..
-    std::fill(potentials.begin(), potentials.end(), 0.0);
-    this->std_well_.computeWellRatesWithBhp(
-        this->ebos_simulator_, bhp, potentials, this->deferred_logger_);
+    if (!this->response_curve_ || !this->response_curve_->findRates(bhp, potentials)) {
+        // NOTE: If we do not clear the potentials here, it will accumulate
+        //   the new potentials to the old values..
+        std::fill(potentials.begin(), potentials.end(), 0.0);
+        this->std_well_.computeWellRatesWithBhp(
+            this->ebos_simulator_, bhp, potentials, this->deferred_logger_);
+        if (this->response_curve_) {
+            this->response_curve_->insertRates(bhp, potentials);
+        }
+    }
     if (debug_output) {
         const std::string msg = fmt::format("computed well potentials given bhp {}, "
             "oil: {}, gas: {}, water: {}", bhp,
@@ -119,11 +127,17 @@ std::optional<double>
 GasLiftSingleWell<TypeTag>::
 computeBhpAtThpLimit_(double alq) const
 {
-    auto bhp_at_thp_limit = this->std_well_.computeBhpAtThpLimitProdWithAlq(
-        this->ebos_simulator_,
-        this->summary_state_,
-        this->deferred_logger_,
-        alq);
+    std::optional<double> bhp_at_thp_limit;
+    if (!this->response_curve_ || !this->response_curve_->findBhp(alq, bhp_at_thp_limit)) {
+        bhp_at_thp_limit = this->std_well_.computeBhpAtThpLimitProdWithAlq(
+            this->ebos_simulator_,
+            this->summary_state_,
+            this->deferred_logger_,
+            alq);
+        if (this->response_curve_) {
+            this->response_curve_->insertBhp(alq, bhp_at_thp_limit);
+        }
+    }
     if (bhp_at_thp_limit) {
         if (*bhp_at_thp_limit < this->controls_.bhp_limit) {
             const std::string msg = fmt::format(
@@ -29,7 +29,9 @@
 #include <opm/simulators/wells/WellInterfaceGeneric.hpp>
 #include <opm/simulators/wells/WellState.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 #include <optional>
 #include <string>
 
@@ -449,20 +451,47 @@ getGroupGliftWellsRecursive_(const Group &group,
     }
 }
 
+// Only the gradients of the given wells have changed since the last
+//   synchronization. For each of these wells the owning rank contributes
+//   a flag telling if the well has an incremental (decremental) gradient
+//   together with the gradient itself, all other ranks contribute zeros,
+//   such that a single sum over the ranks gives the owner's values.
 void
 GasLiftStage2::
-mpiSyncGlobalGradVector_(std::vector<GradPair> &grads_global) const
+mpiSyncChangedGradients_(const std::vector<std::string> &well_names,
+    GradQueue &inc_grads, GradQueue &dec_grads) const
 {
     if (this->comm_.size() == 1)
         return;
 
-    std::vector<GradPair> grads_local;
-    for (auto itr = grads_global.begin(); itr != grads_global.end(); itr++) {
-        if (this->well_state_map_.count(itr->first) > 0) {
-            grads_local.push_back(*itr);
+    std::vector<double> values(4 * well_names.size(), 0.0);
+    for (std::size_t i = 0; i < well_names.size(); ++i) {
+        const auto &name = well_names[i];
+        if (this->well_state_map_.count(name) == 0
+            || !this->well_state_.wellIsOwned(name))
+            continue;
+        if (auto inc_grad = inc_grads.get(name)) {
+            values[4*i] = 1.0;
+            values[4*i + 1] = *inc_grad;
+        }
+        if (auto dec_grad = dec_grads.get(name)) {
+            values[4*i + 2] = 1.0;
+            values[4*i + 3] = *dec_grad;
         }
     }
-    mpiSyncLocalToGlobalGradVector_(grads_local, grads_global);
+    this->comm_.sum(values.data(), values.size());
+
+    for (std::size_t i = 0; i < well_names.size(); ++i) {
+        const auto &name = well_names[i];
+        if (values[4*i] > 0.5)
+            inc_grads.set(name, values[4*i + 1]);
+        else
+            inc_grads.erase(name);
+        if (values[4*i + 2] > 0.5)
+            dec_grads.set(name, values[4*i + 3]);
+        else
+            dec_grads.erase(name);
+    }
 }
 
 void
@@ -517,8 +546,8 @@ optimizeGroup_(const Group &group)
     {
         displayDebugMessage_("optimizing", group.name());
         auto wells = getGroupGliftWells_(group);
-        std::vector<GradPair> inc_grads;
-        std::vector<GradPair> dec_grads;
+        GradQueue inc_grads{/*largest_first=*/true};
+        GradQueue dec_grads{/*largest_first=*/false};
         redistributeALQ_(wells, group, inc_grads, dec_grads);
         removeSurplusALQ_(group, inc_grads, dec_grads);
     }
@@ -553,16 +582,13 @@ optimizeGroupsRecursive_(const Group &group)
 void
 GasLiftStage2::
 recalculateGradientAndUpdateData_(
-    GradPairItr &grad_itr, bool increase,
+    const std::string &name, bool increase,
 
     //incremental and decremental gradients, if 'grads' are incremental, then
     // 'other_grads' are decremental, or conversely, if 'grads' are decremental, then
     // 'other_grads' are incremental
-    std::vector<GradPair> &grads,  std::vector<GradPair> &other_grads)
+    GradQueue &grads, GradQueue &other_grads)
 {
-    // NOTE: We make a copy of the name string instead of taking a reference
-    //   since we may have to erase grad_itr (in the "else" condition below)
-    const std::string name = grad_itr->first;
     std::optional<GradInfo> old_grad = std::nullopt;
 
     // only applies to wells in the well_state_map (i.e. wells on this rank)
@@ -571,11 +597,11 @@ recalculateGradientAndUpdateData_(
         GasLiftSingleWell &gs_well = *(this->stage1_wells_.at(name).get());
         auto grad = calcIncOrDecGrad_(name, gs_well, increase);
         if (grad) {
-            grad_itr->second = grad->grad;
+            grads.set(name, grad->grad);
             old_grad = updateGrad_(name, *grad, increase);
         }
         else {
-            grads.erase(grad_itr); // NOTE: this invalidates grad_itr
+            grads.erase(name);
             old_grad = deleteGrad_(name, increase);
         }
     }
@@ -585,9 +611,7 @@ recalculateGradientAndUpdateData_(
         // The old incremental gradient becomes the new decremental gradient
         //   or the old decremental gradient becomes the new incremental gradient
         updateGrad_(name, *old_grad, !increase);
-        // NOTE: This may invalidate any iterator into 'other_grads' since
-        //   updateGradVector_() will do a push_back() if 'name' is not found..
-        updateGradVector_(name, other_grads, old_grad->grad);
+        other_grads.set(name, old_grad->grad);
     }
 }
 
@@ -637,29 +661,27 @@ recalculateGradientAndUpdateData_(
 void
 GasLiftStage2::
 redistributeALQ_(std::vector<GasLiftSingleWell *> &wells,  const Group &group,
-    std::vector<GradPair> &inc_grads, std::vector<GradPair> &dec_grads)
+    GradQueue &inc_grads, GradQueue &dec_grads)
 {
     OptimizeState state {*this, group};
+    std::vector<GradPair> inc_grads_local;
+    std::vector<GradPair> dec_grads_local;
+    inc_grads_local.reserve(wells.size());
+    dec_grads_local.reserve(wells.size());
+    state.calculateEcoGradients(wells, inc_grads_local, dec_grads_local);
     if (this->comm_.size() == 1) {
-        // NOTE: 'inc_grads' and 'dec_grads' can never grow larger than wells.size()
-        //   By reserving space here, we can ensure that any push_back() on these
-        //   will never reallocate memory and invalidate any iterators.
-        inc_grads.reserve(wells.size());
-        dec_grads.reserve(wells.size());
-        state.calculateEcoGradients(wells, inc_grads, dec_grads);
+        inc_grads.assign(inc_grads_local);
+        dec_grads.assign(dec_grads_local);
     }
     else {
-        auto max_size = this->comm_.sum(wells.size());
-        inc_grads.reserve(max_size);
-        dec_grads.reserve(max_size);
-        std::vector<GradPair> inc_grads_local;
-        std::vector<GradPair> dec_grads_local;
-        inc_grads_local.reserve(wells.size());
-        dec_grads_local.reserve(wells.size());
-        state.calculateEcoGradients(wells, inc_grads_local, dec_grads_local);
-        // the gradients needs to be communicated to all ranks
-        mpiSyncLocalToGlobalGradVector_(dec_grads_local, dec_grads);
-        mpiSyncLocalToGlobalGradVector_(inc_grads_local, inc_grads);
+        // the gradients needs to be communicated to all ranks, later only
+        //   the changed gradients are exchanged
+        std::vector<GradPair> inc_grads_global;
+        std::vector<GradPair> dec_grads_global;
+        mpiSyncLocalToGlobalGradVector_(dec_grads_local, dec_grads_global);
+        mpiSyncLocalToGlobalGradVector_(inc_grads_local, inc_grads_global);
+        inc_grads.assign(inc_grads_global);
+        dec_grads.assign(dec_grads_global);
     }
 
     if (!state.checkAtLeastTwoWells(wells)) {
@@ -678,7 +700,7 @@ redistributeALQ_(std::vector<GasLiftSingleWell *> &wells,  const Group &group,
             assert( max_inc_grad );
             // Redistribute if the largest incremental gradient exceeds the
             //   smallest decremental gradient
-            if ((*max_inc_grad)->second > (*min_dec_grad)->second) {
+            if (max_inc_grad->second > min_dec_grad->second) {
                 state.redistributeALQ(*min_dec_grad, *max_inc_grad);
                 state.recalculateGradients(
                     inc_grads, dec_grads, *min_dec_grad, *max_inc_grad);
@@ -703,7 +725,7 @@ redistributeALQ_(std::vector<GasLiftSingleWell *> &wells,  const Group &group,
 void
 GasLiftStage2::
 removeSurplusALQ_(const Group &group,
-    std::vector<GradPair> &inc_grads, std::vector<GradPair> &dec_grads)
+    GradQueue &inc_grads, GradQueue &dec_grads)
 {
     if (dec_grads.size() == 0) {
         displayDebugMessage2B_("no wells to remove ALQ from. Skipping");
@@ -730,19 +752,14 @@ removeSurplusALQ_(const Group &group,
             min_eco_grad, controls.oil_target, controls.gas_target, max_glift };
 
     while (!stop_iteration) {
-        if (dec_grads.size() >= 2) {
-            sortGradients_(dec_grads);
-        }
-        auto dec_grad_itr = dec_grads.begin();
-        const auto well_name = dec_grad_itr->first;
-        auto eco_grad = dec_grad_itr->second;
+        const auto [well_name, eco_grad] = *dec_grads.top();
         bool remove = false;
         if (state.checkOilTarget() || state.checkGasTarget() || state.checkALQlimit()) {
             remove = true;
         }
         else {
             // NOTE: It is enough to check the economic gradient of the first well
-            //   in dec_grads since they are sorted according to the eco. grad.
+            //   in dec_grads since they are ordered according to the eco. grad.
             //   If the first well's eco. grad. is greater than the minimum
             //   eco. grad. then all the other wells' eco. grad. will also be
             //   greater.
@@ -752,14 +769,12 @@ removeSurplusALQ_(const Group &group,
             state.updateRates(well_name);
             state.addOrRemoveALQincrement( this->dec_grads_, well_name, /*add=*/false);
             recalculateGradientAndUpdateData_(
-                        dec_grad_itr, /*increase=*/false, dec_grads, inc_grads);
+                        well_name, /*increase=*/false, dec_grads, inc_grads);
 
             // The dec_grads and inc_grads needs to be syncronized across ranks
-            mpiSyncGlobalGradVector_(dec_grads);
-            mpiSyncGlobalGradVector_(inc_grads);
+            mpiSyncChangedGradients_({well_name}, inc_grads, dec_grads);
             // NOTE: recalculateGradientAndUpdateData_() will remove the current gradient
             //   from dec_grads if it cannot calculate a new decremental gradient.
-            //   This will invalidate dec_grad_itr and well_name
             if (dec_grads.size() == 0) stop_iteration = true;
             ++state.it;
         }
@@ -809,16 +824,6 @@ saveIncGrad_(const std::string &name, GradInfo &grad)
     saveGrad_(this->inc_grads_, name, grad);
 }
 
-void
-GasLiftStage2::
-sortGradients_(std::vector<GradPair> &grads)
-{
-    auto cmp = [](GradPair a, GradPair b) {
-         return a.second <  b.second;
-    };
-    std::sort(grads.begin(), grads.end(), cmp);
-}
-
 std::optional<GasLiftStage2::GradInfo>
 GasLiftStage2::
 updateGrad_(const std::string &name, GradInfo &grad, bool increase)
@@ -832,21 +837,6 @@ updateGrad_(const std::string &name, GradInfo &grad, bool increase)
     return old_value;
 }
 
-void
-GasLiftStage2::
-updateGradVector_(const std::string &name, std::vector<GradPair> &grads, double grad)
-{
-    for (auto itr = grads.begin(); itr != grads.end(); itr++) {
-        if (itr->first == name) {
-            itr->second = grad;
-            return;
-        }
-    }
-    grads.push_back({name, grad});
-    // NOTE: the gradient vector is no longer sorted, but sorting will be done
-    //   later in getEcoGradients()
-}
-
 /***********************************************
  * Public methods declared in OptimizeState
  ***********************************************/
@@ -902,30 +892,19 @@ debugShowIterationInfo()
     displayDebugMessage_(msg);
 }
 
-std::pair<std::optional<GasLiftStage2::GradPairItr>,
-          std::optional<GasLiftStage2::GradPairItr>>
+std::pair<std::optional<GasLiftStage2::GradPair>,
+          std::optional<GasLiftStage2::GradPair>>
 GasLiftStage2::OptimizeState::
-getEcoGradients(std::vector<GradPair> &inc_grads, std::vector<GradPair> &dec_grads)
+getEcoGradients(GradQueue &inc_grads, GradQueue &dec_grads)
 {
-    if (inc_grads.size() > 0 && dec_grads.size() > 0) {
-        this->parent.sortGradients_(inc_grads);
-        this->parent.sortGradients_(dec_grads);
-        // The largest incremental gradient is the last element
-        auto inc_grad = std::prev(inc_grads.end());
-        std::optional<GradPairItr> inc_grad_opt;
-        std::optional<GradPairItr> dec_grad_opt;
-        // The smallest decremental gradient is at the beginning
-        for (auto itr = dec_grads.begin(); itr != dec_grads.end(); itr++) {
-            if (itr->first == inc_grad->first) {
-                // Don't consider decremental gradients with the same well name
-                continue;
-            }
-            dec_grad_opt = itr;
-            break;
-        }
-        if (dec_grad_opt) {
-            inc_grad_opt = inc_grad;
-            return { dec_grad_opt, inc_grad_opt };
+    // The largest incremental gradient
+    auto inc_grad = inc_grads.top();
+    if (inc_grad) {
+        // The smallest decremental gradient, but don't consider decremental
+        //   gradients with the same well name
+        auto dec_grad = dec_grads.topExcluding(inc_grad->first);
+        if (dec_grad) {
+            return { dec_grad, inc_grad };
         }
     }
     return {std::nullopt, std::nullopt};
@@ -934,8 +913,8 @@ getEcoGradients(std::vector<GradPair> &inc_grads, std::vector<GradPair> &dec_gra
 // Recalculate gradients (and related information, see struct GradInfo in
 //   GasLiftSingleWell.hpp) after an ALQ increment
 //   has been given from the well with minumum decremental gradient (represented
-//   by the input argument min_dec_grad_itr) to the well with the largest
-//   incremental gradient (represented by input argument max_inc_grad_itr).
+//   by the input argument min_dec_grad) to the well with the largest
+//   incremental gradient (represented by input argument max_inc_grad).
 //
 // For the well with the largest incremental gradient, we compute a new
 //   incremental gradient given the new ALQ. The new decremental gradient for this
@@ -947,34 +926,35 @@ getEcoGradients(std::vector<GradPair> &inc_grads, std::vector<GradPair> &dec_gra
 void
 GasLiftStage2::OptimizeState::
 recalculateGradients(
-         std::vector<GradPair> &inc_grads, std::vector<GradPair> &dec_grads,
-         GradPairItr &min_dec_grad_itr, GradPairItr &max_inc_grad_itr)
+         GradQueue &inc_grads, GradQueue &dec_grads,
+         const GradPair &min_dec_grad, const GradPair &max_inc_grad)
 {
     this->parent.recalculateGradientAndUpdateData_(
-        max_inc_grad_itr, /*increase=*/true, inc_grads, dec_grads);
+        max_inc_grad.first, /*increase=*/true, inc_grads, dec_grads);
     this->parent.recalculateGradientAndUpdateData_(
-        min_dec_grad_itr, /*increase=*/false, dec_grads, inc_grads);
+        min_dec_grad.first, /*increase=*/false, dec_grads, inc_grads);
 
-    // The dec_grads and inc_grads needs to be syncronized across ranks
-    this->parent.mpiSyncGlobalGradVector_(dec_grads);
-    this->parent.mpiSyncGlobalGradVector_(inc_grads);
+    // The dec_grads and inc_grads needs to be syncronized across ranks,
+    //   only the gradients of the two wells have changed
+    this->parent.mpiSyncChangedGradients_(
+        {min_dec_grad.first, max_inc_grad.first}, inc_grads, dec_grads);
 }
 
 // Take one ALQ increment from well1, and give it to well2
 void
 GasLiftStage2::OptimizeState::
-    redistributeALQ( GradPairItr &min_dec_grad, GradPairItr &max_inc_grad)
+    redistributeALQ(const GradPair &min_dec_grad, const GradPair &max_inc_grad)
 {
     const std::string msg = fmt::format(
         "redistributing ALQ from well {} (dec gradient: {}) "
         "to well {} (inc gradient {})",
-        min_dec_grad->first, min_dec_grad->second,
-        max_inc_grad->first, max_inc_grad->second);
+        min_dec_grad.first, min_dec_grad.second,
+        max_inc_grad.first, max_inc_grad.second);
     displayDebugMessage_(msg);
     this->parent.addOrRemoveALQincrement_(
-        this->parent.dec_grads_, /*well_name=*/min_dec_grad->first, /*add=*/false);
+        this->parent.dec_grads_, /*well_name=*/min_dec_grad.first, /*add=*/false);
     this->parent.addOrRemoveALQincrement_(
-        this->parent.inc_grads_, /*well_name=*/max_inc_grad->first, /*add=*/true);
+        this->parent.inc_grads_, /*well_name=*/max_inc_grad.first, /*add=*/true);
 }
 
 /**********************************************
@@ -1118,4 +1098,138 @@ updateRates(const std::string &well_name)
     this->alq += delta_alq;
 }
 
+/**********************************************
+ * Methods declared in GradQueue
+ **********************************************/
+
+GasLiftStage2::GradQueue::
+GradQueue(bool largest_first) :
+    largest_first_{largest_first}
+{
+}
+
+void
+GasLiftStage2::GradQueue::
+assign(const std::vector<GradPair> &grads)
+{
+    this->current_.clear();
+    this->heap_.clear();
+    for (const auto& [name, grad] : grads) {
+        this->current_[name] = {grad, ++this->version_};
+    }
+    rebuild_();
+}
+
+void
+GasLiftStage2::GradQueue::
+erase(const std::string &name)
+{
+    this->current_.erase(name);
+}
+
+std::optional<double>
+GasLiftStage2::GradQueue::
+get(const std::string &name) const
+{
+    auto it = this->current_.find(name);
+    if (it == this->current_.end())
+        return std::nullopt;
+    return it->second.first;
+}
+
+void
+GasLiftStage2::GradQueue::
+set(const std::string &name, double grad)
+{
+    this->current_[name] = {grad, ++this->version_};
+    // NOTE: Outdated entries are only removed when they reach the top, so
+    //   rebuild the heap before it grows much larger than the number of wells
+    if (this->heap_.size() >= 2 * this->current_.size()) {
+        rebuild_();
+    }
+    else {
+        this->heap_.push_back({grad, this->version_, name});
+        std::push_heap(this->heap_.begin(), this->heap_.end(),
+            [this](const Entry &a, const Entry &b) { return after_(a, b); });
+    }
+}
+
+std::optional<GasLiftStage2::GradPair>
+GasLiftStage2::GradQueue::
+top()
+{
+    popStale_();
+    if (this->heap_.empty())
+        return std::nullopt;
+    const auto &entry = this->heap_.front();
+    return GradPair{entry.name, entry.grad};
+}
+
+std::optional<GasLiftStage2::GradPair>
+GasLiftStage2::GradQueue::
+topExcluding(const std::string &name)
+{
+    popStale_();
+    if (this->heap_.empty())
+        return std::nullopt;
+    if (this->heap_.front().name != name)
+        return GradPair{this->heap_.front().name, this->heap_.front().grad};
+
+    // Look at the entry below the top, and put the top entry back afterwards
+    auto cmp = [this](const Entry &a, const Entry &b) { return after_(a, b); };
+    std::pop_heap(this->heap_.begin(), this->heap_.end(), cmp);
+    Entry first = std::move(this->heap_.back());
+    this->heap_.pop_back();
+    popStale_();
+    std::optional<GradPair> result;
+    if (!this->heap_.empty())
+        result = GradPair{this->heap_.front().name, this->heap_.front().grad};
+    this->heap_.push_back(std::move(first));
+    std::push_heap(this->heap_.begin(), this->heap_.end(), cmp);
+    return result;
+}
+
+// Heap order: true if entry 'a' comes after entry 'b'. Equal gradients are
+//   ordered by well name, such that all ranks pick the same well.
+bool
+GasLiftStage2::GradQueue::
+after_(const Entry &a, const Entry &b) const
+{
+    if (a.grad != b.grad)
+        return this->largest_first_ ? (a.grad < b.grad) : (a.grad > b.grad);
+    return a.name > b.name;
+}
+
+bool
+GasLiftStage2::GradQueue::
+isStale_(const Entry &entry) const
+{
+    auto it = this->current_.find(entry.name);
+    return it == this->current_.end() || it->second.second != entry.version;
+}
+
+void
+GasLiftStage2::GradQueue::
+popStale_()
+{
+    auto cmp = [this](const Entry &a, const Entry &b) { return after_(a, b); };
+    while (!this->heap_.empty() && isStale_(this->heap_.front())) {
+        std::pop_heap(this->heap_.begin(), this->heap_.end(), cmp);
+        this->heap_.pop_back();
+    }
+}
+
+void
+GasLiftStage2::GradQueue::
+rebuild_()
+{
+    this->heap_.clear();
+    this->heap_.reserve(this->current_.size());
+    for (const auto& [name, value] : this->current_) {
+        this->heap_.push_back({value.first, value.second, name});
+    }
+    std::make_heap(this->heap_.begin(), this->heap_.end(),
+        [this](const Entry &a, const Entry &b) { return after_(a, b); });
+}
+
 } // namespace Opm
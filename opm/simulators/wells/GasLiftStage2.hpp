@@ -51,7 +51,6 @@ class GasLiftStage2 {
     using GLiftProdWells = std::map<std::string,const WellInterfaceGeneric*>;
     using GLiftWellStateMap = std::map<std::string,std::unique_ptr<GasLiftWellState>>;
     using GradPair = std::pair<std::string, double>;
-    using GradPairItr = std::vector<GradPair>::iterator;
     using GradInfo = typename GasLiftSingleWellGeneric::GradInfo;
     using GradMap = std::map<std::string, GradInfo>;
     using MPIComm = typename Dune::MPIHelper::MPICommunicator;
@@ -63,6 +62,42 @@ class GasLiftStage2 {
     static const int Water = BlackoilPhases::Aqua;
     static const int Oil = BlackoilPhases::Liquid;
     static const int Gas = BlackoilPhases::Vapour;
+
+public:
+    // The incremental or decremental gradients of the wells in a group,
+    //   kept in a binary heap such that the largest (incremental) or
+    //   smallest (decremental) gradient is found without sorting after each
+    //   ALQ change. An update pushes a new heap entry, the outdated entry
+    //   is skipped when it reaches the top of the heap.
+    class GradQueue {
+    public:
+        explicit GradQueue(bool largest_first);
+        void assign(const std::vector<GradPair>& grads);
+        void erase(const std::string& name);
+        std::optional<double> get(const std::string& name) const;
+        void set(const std::string& name, double grad);
+        std::size_t size() const { return current_.size(); }
+        std::optional<GradPair> top();
+        // The first gradient that does not belong to the given well
+        std::optional<GradPair> topExcluding(const std::string& name);
+    private:
+        struct Entry {
+            double grad;
+            std::size_t version;
+            std::string name;
+        };
+        bool after_(const Entry& a, const Entry& b) const;
+        bool isStale_(const Entry& entry) const;
+        void popStale_();
+        void rebuild_();
+
+        // current gradient and version of each well
+        std::map<std::string, std::pair<double, std::size_t>> current_;
+        std::vector<Entry> heap_;
+        bool largest_first_;
+        std::size_t version_ = 0;
+    };
+
 public:
     GasLiftStage2(
         const int report_step_idx,
@@ -104,23 +139,21 @@ private:
     void optimizeGroup_(const Group& group);
     void optimizeGroupsRecursive_(const Group& group);
     void recalculateGradientAndUpdateData_(
-        GradPairItr& grad_itr, bool increase,
-        std::vector<GradPair>& grads, std::vector<GradPair>& other_grads);
+        const std::string& name, bool increase,
+        GradQueue& grads, GradQueue& other_grads);
     void redistributeALQ_(
         std::vector<GasLiftSingleWell *>& wells,  const Group& group,
-        std::vector<GradPair>& inc_grads, std::vector<GradPair>& dec_grads);
+        GradQueue& inc_grads, GradQueue& dec_grads);
     void removeSurplusALQ_(
-        const Group& group,
-        std::vector<GradPair>& inc_grads, std::vector<GradPair>& dec_grads);
+        const Group& group, GradQueue& inc_grads, GradQueue& dec_grads);
     void saveGrad_(GradMap& map, const std::string& name, GradInfo& grad);
     void saveDecGrad_(const std::string& name, GradInfo& grad);
     void saveIncGrad_(const std::string& name, GradInfo& grad);
-    void sortGradients_(std::vector<GradPair>& grads);
     std::optional<GradInfo> updateGrad_(
         const std::string& name, GradInfo& grad, bool increase);
-    void updateGradVector_(
-        const std::string& name, std::vector<GradPair>& grads, double grad);
-    void mpiSyncGlobalGradVector_(std::vector<GradPair>& grads_global) const;
+    void mpiSyncChangedGradients_(
+        const std::vector<std::string>& well_names,
+        GradQueue& inc_grads, GradQueue& dec_grads) const;
     void mpiSyncLocalToGlobalGradVector_(
         const std::vector<GradPair>& grads_local,
         std::vector<GradPair>& grads_global) const;
@@ -155,19 +188,19 @@ private:
 
         using GradInfo = typename GasLiftStage2::GradInfo;
         using GradPair = typename GasLiftStage2::GradPair;
-        using GradPairItr = typename GasLiftStage2::GradPairItr;
         using GradMap = typename GasLiftStage2::GradMap;
+        using GradQueue = typename GasLiftStage2::GradQueue;
         void calculateEcoGradients(std::vector<GasLiftSingleWell *>& wells,
             std::vector<GradPair>& inc_grads, std::vector<GradPair>& dec_grads);
         bool checkAtLeastTwoWells(std::vector<GasLiftSingleWell *>& wells);
         void debugShowIterationInfo();
-        std::pair<std::optional<GradPairItr>,std::optional<GradPairItr>>
-        getEcoGradients(
-            std::vector<GradPair>& inc_grads, std::vector<GradPair>& dec_grads);
+        std::pair<std::optional<GradPair>,std::optional<GradPair>>
+        getEcoGradients(GradQueue& inc_grads, GradQueue& dec_grads);
         void recalculateGradients(
-            std::vector<GradPair>& inc_grads, std::vector<GradPair>& dec_grads,
-            GradPairItr& min_dec_grad_itr, GradPairItr &max_inc_grad_itr);
-        void redistributeALQ( GradPairItr& min_dec_grad, GradPairItr& max_inc_grad);
+            GradQueue& inc_grads, GradQueue& dec_grads,
+            const GradPair& min_dec_grad, const GradPair& max_inc_grad);
+        void redistributeALQ(
+            const GradPair& min_dec_grad, const GradPair& max_inc_grad);
 
     private:
         void displayDebugMessage_(const std::string& msg);
@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include <stdexcept>
+#include <utility>
 
 #include <opm/simulators/wells/GlobalWellInfo.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
@@ -31,11 +32,13 @@ GlobalWellInfo::GlobalWellInfo(const Schedule& sched, std::size_t report_step, c
     auto num_wells = sched.numWells(report_step);
     this->m_in_injecting_group.resize(num_wells);
     this->m_in_producing_group.resize(num_wells);
+    std::map<std::string, std::size_t> names;
     for (const auto& wname : sched.wellNames(report_step)) {
         const auto& well = sched.getWell(wname, report_step);
         auto global_well_index = well.seqIndex();
-        this->name_map.emplace( well.name(), global_well_index );
+        names.emplace( well.name(), global_well_index );
     }
+    this->name_map = std::make_shared<const std::map<std::string, std::size_t>>(std::move(names));
 
     for (const auto& well : local_wells) {
         this->local_map.push_back( well.seqIndex() );
@@ -45,13 +48,13 @@ GlobalWellInfo::GlobalWellInfo(const Schedule& sched, std::size_t report_step, c
 
 
 bool GlobalWellInfo::in_injecting_group(const std::string& wname) const {
-    auto global_well_index = this->name_map.at(wname);
+    auto global_well_index = this->name_map->at(wname);
     return this->m_in_injecting_group[global_well_index];
 }
 
 
 bool GlobalWellInfo::in_producing_group(const std::string& wname) const {
-    auto global_well_index = this->name_map.at(wname);
+    auto global_well_index = this->name_map->at(wname);
     return this->m_in_producing_group[global_well_index];
 }
 
@@ -60,8 +63,8 @@ void GlobalWellInfo::update_group(const std::vector<Well::Status>& well_status,
     if (well_status.size() != this->local_map.size())
         throw std::logic_error("Size mismatch");
 
-    this->m_in_injecting_group.assign(this->name_map.size(), 0);
-    this->m_in_producing_group.assign(this->name_map.size(), 0);
+    this->m_in_injecting_group.assign(this->name_map->size(), 0);
+    this->m_in_producing_group.assign(this->name_map->size(), 0);
     for (std::size_t well_index = 0; well_index < well_status.size(); well_index++) {
         if (well_status[well_index] == Well::Status::OPEN) {
             if (this->is_injector[well_index]) {
@@ -77,11 +80,11 @@ void GlobalWellInfo::update_group(const std::vector<Well::Status>& well_status,
 
 
 std::size_t GlobalWellInfo::well_index(const std::string& wname) const {
-    return this->name_map.at(wname);
+    return this->name_map->at(wname);
 }
 
 const std::string& GlobalWellInfo::well_name(std::size_t well_index) const {
-    for (const auto& [name, index] : this->name_map) {
+    for (const auto& [name, index] : *this->name_map) {
         if (index == well_index)
             return name;
     }
@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -77,7 +78,8 @@ private:
     std::vector<std::size_t> local_map;    // local_index -> global_index
     std::vector<bool> is_injector;         // local_index -> bool
 
-    std::map<std::string, std::size_t> name_map; // string -> global_index
+    // string -> global_index, the same for all copies of the well state
+    std::shared_ptr<const std::map<std::string, std::size_t>> name_map;
     std::vector<int> m_in_injecting_group;       // global_index -> int/bool
     std::vector<int> m_in_producing_group;       // global_index -> int/bool
 };
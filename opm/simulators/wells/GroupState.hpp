@@ -150,6 +150,22 @@ public:
 
     std::string dump() const;
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(num_phases);
+        serializer(m_production_rates);
+        serializer(production_controls);
+        serializer(prod_red_rates);
+        serializer(inj_red_rates);
+        serializer(inj_resv_rates);
+        serializer(inj_potentials);
+        serializer(inj_rein_rates);
+        serializer(inj_vrep_rate);
+        serializer(m_grat_sales_target);
+        serializer(injection_controls);
+    }
+
 
 private:
     std::size_t num_phases;
@@ -142,7 +142,7 @@ namespace Opm
 
         /// computing the well potentials for group control
         virtual void computeWellPotentials(const Simulator& ebosSimulator,
-                                           const WellState& well_state,
+                                           WellState& well_state,
                                            std::vector<double>& well_potentials,
                                            DeferredLogger& deferred_logger) override;
 
@@ -264,6 +264,7 @@ namespace Opm
 
         void computeWellRatesAtBhpLimit(const Simulator& ebosSimulator,
                                         std::vector<double>& well_flux,
+                                        WellState& well_state,
                                         DeferredLogger& deferred_logger) const;
 
         void computeWellRatesWithBhp(const Simulator& ebosSimulator,
@@ -271,8 +272,17 @@ namespace Opm
                                      std::vector<double>& well_flux,
                                      DeferredLogger& deferred_logger) const;
 
+        // as above, using and modifying the entries of this well in a copy
+        // of the well state owned by the caller
+        void computeWellRatesWithBhp(const Simulator& ebosSimulator,
+                                     const Scalar bhp,
+                                     std::vector<double>& well_flux,
+                                     WellState& well_state_copy,
+                                     DeferredLogger& deferred_logger) const;
+
         std::vector<double>
         computeWellPotentialWithTHP(const Simulator& ebos_simulator,
+                                    WellState& well_state,
                                     DeferredLogger& deferred_logger) const;
 
         virtual double getRefDensity() const override;
@@ -242,7 +242,7 @@ namespace Opm
     void
     MultisegmentWell<TypeTag>::
     computeWellPotentials(const Simulator& ebosSimulator,
-                          const WellState& well_state,
+                          WellState& well_state,
                           std::vector<double>& well_potentials,
                           DeferredLogger& deferred_logger)
     {
@@ -280,9 +280,9 @@ namespace Opm
         // does the well have a THP related constraint?
         const auto& summaryState = ebosSimulator.vanguard().summaryState();
         if (!Base::wellHasTHPConstraints(summaryState)) {
-            computeWellRatesAtBhpLimit(ebosSimulator, well_potentials, deferred_logger);
+            computeWellRatesAtBhpLimit(ebosSimulator, well_potentials, well_state, deferred_logger);
         } else {
-            well_potentials = computeWellPotentialWithTHP(ebosSimulator, deferred_logger);
+            well_potentials = computeWellPotentialWithTHP(ebosSimulator, well_state, deferred_logger);
         }
         deferred_logger.debug("Cost in iterations of finding well potential for well "
                               + name() + ": " + std::to_string(debug_cost_counter_));
@@ -296,14 +296,15 @@ namespace Opm
     MultisegmentWell<TypeTag>::
     computeWellRatesAtBhpLimit(const Simulator& ebosSimulator,
                                std::vector<double>& well_flux,
+                               WellState& well_state,
                                DeferredLogger& deferred_logger) const
     {
         if (well_ecl_.isInjector()) {
             const auto controls = well_ecl_.injectionControls(ebosSimulator.vanguard().summaryState());
-            computeWellRatesWithBhp(ebosSimulator, controls.bhp_limit, well_flux, deferred_logger);
+            computeWellRatesWithBhp(ebosSimulator, controls.bhp_limit, well_flux, well_state, deferred_logger);
         } else {
             const auto controls = well_ecl_.productionControls(ebosSimulator.vanguard().summaryState());
-            computeWellRatesWithBhp(ebosSimulator, controls.bhp_limit, well_flux, deferred_logger);
+            computeWellRatesWithBhp(ebosSimulator, controls.bhp_limit, well_flux, well_state, deferred_logger);
         }
     }
 
@@ -316,14 +317,28 @@ namespace Opm
                             const Scalar bhp,
                             std::vector<double>& well_flux,
                             DeferredLogger& deferred_logger) const
+    {
+        // store a copy of the well state, we don't want to update the real well state
+        WellState well_state_copy = ebosSimulator.problem().wellModel().wellState();
+        computeWellRatesWithBhp(ebosSimulator, bhp, well_flux, well_state_copy, deferred_logger);
+    }
+
+
+
+    template<typename TypeTag>
+    void
+    MultisegmentWell<TypeTag>::
+    computeWellRatesWithBhp(const Simulator& ebosSimulator,
+                            const Scalar bhp,
+                            std::vector<double>& well_flux,
+                            WellState& well_state_copy,
+                            DeferredLogger& deferred_logger) const
     {
         // creating a copy of the well itself, to avoid messing up the explicit informations
         // during this copy, the only information not copied properly is the well controls
         MultisegmentWell<TypeTag> well_copy(*this);
         well_copy.debug_cost_counter_ = 0;
 
-        // store a copy of the well state, we don't want to update the real well state
-        WellState well_state_copy = ebosSimulator.problem().wellModel().wellState();
         const auto& group_state = ebosSimulator.problem().wellModel().groupState();
 
         // Get the current controls.
@@ -377,6 +392,7 @@ namespace Opm
     std::vector<double>
     MultisegmentWell<TypeTag>::
     computeWellPotentialWithTHP(const Simulator& ebos_simulator,
+                                WellState& well_state,
                                 DeferredLogger& deferred_logger) const
     {
         std::vector<double> potentials(number_of_phases_, 0.0);
@@ -388,7 +404,7 @@ namespace Opm
             if (bhp_at_thp_limit) {
                 const auto& controls = well_ecl_.injectionControls(summary_state);
                 const double bhp = std::min(*bhp_at_thp_limit, controls.bhp_limit);
-                computeWellRatesWithBhp(ebos_simulator, bhp, potentials, deferred_logger);
+                computeWellRatesWithBhp(ebos_simulator, bhp, potentials, well_state, deferred_logger);
                 deferred_logger.debug("Converged thp based potential calculation for well "
                                       + name() + ", at bhp = " + std::to_string(bhp));
             } else {
@@ -397,14 +413,14 @@ namespace Opm
                                         + name() + ". Instead the bhp based value is used");
                 const auto& controls = well_ecl_.injectionControls(summary_state);
                 const double bhp = controls.bhp_limit;
-                computeWellRatesWithBhp(ebos_simulator, bhp, potentials, deferred_logger);
+                computeWellRatesWithBhp(ebos_simulator, bhp, potentials, well_state, deferred_logger);
             }
         } else {
             auto bhp_at_thp_limit = computeBhpAtThpLimitProd(ebos_simulator, summary_state, deferred_logger);
             if (bhp_at_thp_limit) {
                 const auto& controls = well_ecl_.productionControls(summary_state);
                 const double bhp = std::max(*bhp_at_thp_limit, controls.bhp_limit);
-                computeWellRatesWithBhp(ebos_simulator, bhp, potentials, deferred_logger);
+                computeWellRatesWithBhp(ebos_simulator, bhp, potentials, well_state, deferred_logger);
                 deferred_logger.debug("Converged thp based potential calculation for well "
                                       + name() + ", at bhp = " + std::to_string(bhp));
             } else {
@@ -413,7 +429,7 @@ namespace Opm
                                         + name() + ". Instead the bhp based value is used");
                 const auto& controls = well_ecl_.productionControls(summary_state);
                 const double bhp = controls.bhp_limit;
-                computeWellRatesWithBhp(ebos_simulator, bhp, potentials, deferred_logger);
+                computeWellRatesWithBhp(ebos_simulator, bhp, potentials, well_state, deferred_logger);
             }
         }
 
@@ -641,17 +657,24 @@ namespace Opm
         // perforation at cell j connected to segment i.  The code
         // assumes that no cell is connected to more than one segment,
         // i.e. the columns of B/C have no more than one nonzero.
+        const auto& blocks = this->jacobianBlocks(jacobian, [this](auto&& visit) {
+            for (size_t rowC = 0; rowC < this->duneC_.N(); ++rowC)
+                for (auto colC = this->duneC_[rowC].begin(), endC = this->duneC_[rowC].end(); colC != endC; ++colC)
+                    for (size_t rowB = 0; rowB < this->duneB_.N(); ++rowB)
+                        for (auto colB = this->duneB_[rowB].begin(), endB = this->duneB_[rowB].end(); colB != endB; ++colB)
+                            visit(colC.index(), colB.index());
+        });
+
+        auto block = blocks.begin();
         for (size_t rowC = 0; rowC < this->duneC_.N(); ++rowC) {
             for (auto colC = this->duneC_[rowC].begin(), endC = this->duneC_[rowC].end(); colC != endC; ++colC) {
-                const auto row_index = colC.index();
                 for (size_t rowB = 0; rowB < this->duneB_.N(); ++rowB) {
                     for (auto colB = this->duneB_[rowB].begin(), endB = this->duneB_[rowB].end(); colB != endB; ++colB) {
-                        const auto col_index = colB.index();
                         OffDiagMatrixBlockWellType tmp1;
                         Detail::multMatrixImpl(invDuneD[rowC][rowB], (*colB), tmp1, std::true_type());
                         typename SparseMatrixAdapter::MatrixBlock tmp2;
                         Detail::multMatrixTransposedImpl((*colC), tmp1, tmp2, std::false_type());
-                        jacobian.addToBlock(row_index, col_index, tmp2);
+                        **block++ += tmp2;
                     }
                 }
             }
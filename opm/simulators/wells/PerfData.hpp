@@ -31,14 +31,32 @@ namespace Opm
 class PerfData
 {
 private:
-    PhaseUsage pu;
-    bool injector;
+    PhaseUsage pu{};
+    bool injector{false};
 
 public:
+    PerfData() = default;
     PerfData(std::size_t num_perf, bool injector_, const PhaseUsage& pu);
     std::size_t size() const;
     bool try_assign(const PerfData& other);
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(pu);
+        serializer(injector);
+        serializer(pressure);
+        serializer(rates);
+        serializer(phase_rates);
+        serializer(solvent_rates);
+        serializer(polymer_rates);
+        serializer(brine_rates);
+        serializer(prod_index);
+        serializer(water_throughput);
+        serializer(skin_pressure);
+        serializer(water_velocity);
+    }
+
 
     std::vector<double> pressure;
     std::vector<double> rates;
@@ -40,6 +40,17 @@ public:
     const std::vector<int>& segment_number() const;
     std::size_t size() const;
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(rates);
+        serializer(pressure);
+        serializer(pressure_drop_friction);
+        serializer(pressure_drop_hydrostatic);
+        serializer(pressure_drop_accel);
+        serializer(m_segment_number);
+    }
+
     std::vector<double> rates;
     std::vector<double> pressure;
     std::vector<double> pressure_drop_friction;
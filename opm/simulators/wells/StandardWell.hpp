@@ -192,7 +192,7 @@ namespace Opm
 
         /// computing the well potentials for group control
         virtual void computeWellPotentials(const Simulator& ebosSimulator,
-                                           const WellState& well_state,
+                                           WellState& well_state,
                                            std::vector<double>& well_potentials,
                                            DeferredLogger& deferred_logger) /* const */ override;
 
@@ -266,6 +266,12 @@ namespace Opm
             std::vector<double>& well_flux,
             DeferredLogger& deferred_logger) const;
 
+        // The rates computed during earlier gas lift optimizations of this
+        // well, cleared if the controls or the connection cell states have
+        // changed by more than the tolerance. nullptr if reuse is disabled.
+        GasLiftSingleWellGeneric::ResponseCurve*
+        gasLiftResponseCurve(const Simulator& ebos_simulator) const;
+
         // NOTE: These cannot be protected since they are used by GasLiftRuntime
         using Base::phaseUsage;
         using Base::vfp_properties_;
@@ -371,6 +377,7 @@ namespace Opm
         void computeWellRatesWithBhpPotential(const Simulator& ebosSimulator,
                                               const double& bhp,
                                               std::vector<double>& well_flux,
+                                              WellState& well_state,
                                               DeferredLogger& deferred_logger);
 
         std::vector<double> computeWellPotentialWithTHP(
@@ -504,6 +511,7 @@ namespace Opm
                                                       const SummaryState& summary_state,
                                                       DeferredLogger& deferred_logger) const;
 
+        mutable GasLiftSingleWellGeneric::ResponseCurve glift_response_curve_;
     };
 
 }
@@ -1375,13 +1375,13 @@ namespace Opm
     computeWellRatesWithBhpPotential(const Simulator& ebosSimulator,
                             const double& bhp,
                             std::vector<double>& well_flux,
+                            WellState& well_state_copy,
                             DeferredLogger& deferred_logger)
     {
 
         // iterate to get a more accurate well density
-        // create a copy of the well_state to use. If the operability checking is sucessful, we use this one
-        // to replace the original one
-        WellState well_state_copy = ebosSimulator.problem().wellModel().wellState();
+        // well_state_copy is a copy of the well state owned by the caller, only
+        // the entries of this well are modified
         const auto& group_state  = ebosSimulator.problem().wellModel().groupState();
 
         //  Set current control to bhp, and bhp value in state, modify bhp limit in control object.
@@ -1490,6 +1490,46 @@ namespace Opm
                                              alq);
     }
 
+    template<typename TypeTag>
+    GasLiftSingleWellGeneric::ResponseCurve*
+    StandardWell<TypeTag>::
+    gasLiftResponseCurve(const Simulator& ebos_simulator) const
+    {
+        const double tolerance = param_.glift_curve_tolerance_;
+        if (tolerance < 0.0) {
+            return nullptr;
+        }
+
+        const auto& summary_state = ebos_simulator.vanguard().summaryState();
+        const auto prod_controls = well_ecl_.productionControls(summary_state);
+        std::vector<double> controls = {prod_controls.bhp_limit, prod_controls.thp_limit,
+                                        static_cast<double>(prod_controls.vfp_table_number)};
+
+        // the quantities entering the connection rates at a given bhp
+        std::vector<double> cell_state;
+        for (int perf = 0; perf < number_of_perforations_; ++perf) {
+            const int cell_idx = well_cells_[perf];
+            const auto& intQuants = *(ebos_simulator.model().cachedIntensiveQuantities(cell_idx, /*timeIdx=*/ 0));
+            const auto& fs = intQuants.fluidState();
+            for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx) {
+                if (!FluidSystem::phaseIsActive(phaseIdx)) {
+                    continue;
+                }
+                cell_state.push_back(fs.pressure(phaseIdx).value());
+                cell_state.push_back(intQuants.mobility(phaseIdx).value());
+                cell_state.push_back(fs.invB(phaseIdx).value());
+            }
+            cell_state.push_back(fs.Rs().value());
+            cell_state.push_back(fs.Rv().value());
+            cell_state.push_back(this->perf_pressure_diffs_[perf]);
+        }
+
+        if (!glift_response_curve_.matches(cell_state, controls, tolerance)) {
+            glift_response_curve_.reset(std::move(cell_state), std::move(controls));
+        }
+        return &glift_response_curve_;
+    }
+
     template<typename TypeTag>
     void
     StandardWell<TypeTag>::
@@ -1524,7 +1564,7 @@ namespace Opm
     void
     StandardWell<TypeTag>::
     computeWellPotentials(const Simulator& ebosSimulator,
-                          const WellState& well_state,
+                          WellState& well_state,
                           std::vector<double>& well_potentials,
                           DeferredLogger& deferred_logger) // const
     {
@@ -1568,7 +1608,7 @@ namespace Opm
             // get the bhp value based on the bhp constraints
             const double bhp = well.mostStrictBhpFromBhpLimits(summaryState);
             assert(std::abs(bhp) != std::numeric_limits<double>::max());
-            well.computeWellRatesWithBhpPotential(ebosSimulator, bhp, well_potentials, deferred_logger);
+            well.computeWellRatesWithBhpPotential(ebosSimulator, bhp, well_potentials, well_state, deferred_logger);
         } else {
             // the well has a THP related constraint
             well_potentials = well.computeWellPotentialWithTHP(ebosSimulator, deferred_logger, well_state);
@@ -1694,17 +1734,28 @@ namespace Opm
         // D is diagonal
         // B and C have 1 row, nc colums and nonzero
         // at (0,j) only if this well has a perforation at cell j.
+        const auto& blocks = this->jacobianBlocks(jacobian, [this](auto&& visit) {
+            for ( auto colC = this->duneC_[0].begin(), endC = this->duneC_[0].end(); colC != endC; ++colC )
+                for ( auto colB = this->duneB_[0].begin(), endB = this->duneB_[0].end(); colB != endB; ++colB )
+                    visit(colC.index(), colB.index());
+        });
+
+        // D^-1 B only depends on the column
+        std::vector<Dune::DynamicMatrix<Scalar>> invDB(this->duneB_[0].size());
+        auto invDBIt = invDB.begin();
+        for ( auto colB = this->duneB_[0].begin(), endB = this->duneB_[0].end(); colB != endB; ++colB, ++invDBIt )
+        {
+            Detail::multMatrix(this->invDuneD_[0][0],  (*colB), *invDBIt);
+        }
+
         typename SparseMatrixAdapter::MatrixBlock tmpMat;
-        Dune::DynamicMatrix<Scalar> tmp;
+        auto block = blocks.begin();
         for ( auto colC = this->duneC_[0].begin(), endC = this->duneC_[0].end(); colC != endC; ++colC )
         {
-            const auto row_index = colC.index();
-
-            for ( auto colB = this->duneB_[0].begin(), endB = this->duneB_[0].end(); colB != endB; ++colB )
+            for ( const auto& tmp : invDB )
             {
-                Detail::multMatrix(this->invDuneD_[0][0],  (*colB), tmp);
                 Detail::negativeMultMatrixTransposed((*colC), tmp, tmpMat);
-                jacobian.addToBlock( row_index, colB.index(), tmpMat );
+                **block++ += tmpMat;
             }
         }
     }
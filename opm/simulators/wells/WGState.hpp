@@ -36,6 +36,13 @@ struct WGState {
 
     WellState well_state;
     GroupState group_state;
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        well_state.serializeOp(serializer);
+        group_state.serializeOp(serializer);
+    }
 };
 
 }
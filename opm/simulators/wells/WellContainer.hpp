@@ -21,9 +21,12 @@
 #define OPM_WELL_CONTAINER_HEADER_INCLUDED
 
 #include <initializer_list>
+#include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -38,6 +41,11 @@ namespace Opm {
   The class is created to facilitate safe and piecewise refactoring of the
   WellState class, and might have a short life in the
   development timeline.
+
+  The well names change far less often than the values, and the well state is
+  copied several times per time step. Copies of a container therefore share
+  the map from names to indices until one of them adds or removes wells, such
+  that a copy only copies the values.
 */
 
 
@@ -54,7 +62,7 @@ public:
     }
 
     bool empty() const {
-        return this->index_map.empty();
+        return this->index_map().empty();
     }
 
     std::size_t size() const {
@@ -62,33 +70,33 @@ public:
     }
 
     void add(const std::string& name, T&& value) {
-        if (index_map.count(name) != 0)
+        if (this->index_map().count(name) != 0)
             throw std::logic_error("An object with name: " + name + " already exists in container");
 
-        this->index_map.emplace(name, this->m_data.size());
+        this->mutable_index_map().emplace(name, this->m_data.size());
         this->m_data.push_back(std::forward<T>(value));
     }
 
     void add(const std::string& name, const T& value) {
-        if (index_map.count(name) != 0)
+        if (this->index_map().count(name) != 0)
             throw std::logic_error("An object with name: " + name + " already exists in container");
 
-        this->index_map.emplace(name, this->m_data.size());
+        this->mutable_index_map().emplace(name, this->m_data.size());
         this->m_data.push_back(value);
     }
 
     bool has(const std::string& name) const {
-        return (index_map.count(name) != 0);
+        return (this->index_map().count(name) != 0);
     }
 
 
     void update(const std::string& name, T&& value) {
-        auto index = this->index_map.at(name);
+        auto index = this->index_map().at(name);
         this->m_data[index] = std::forward<T>(value);
     }
 
     void update(const std::string& name, const T& value) {
-        auto index = this->index_map.at(name);
+        auto index = this->index_map().at(name);
         this->m_data[index] = value;
     }
 
@@ -105,10 +113,10 @@ public:
       in both containers.
     */
     void copy_welldata(const WellContainer<T>& other) {
-        if (this->index_map == other.index_map)
+        if (this->index_map_ptr == other.index_map_ptr || this->index_map() == other.index_map())
             this->m_data = other.m_data;
         else {
-            for (const auto& [name, index] : this->index_map)
+            for (const auto& [name, index] : this->index_map())
                 this->update_if(index, name, other);
         }
     }
@@ -118,8 +126,8 @@ public:
       exist in both containers, otherwise an exception is thrown.
     */
     void copy_welldata(const WellContainer<T>& other, const std::string& name) {
-        auto this_index = this->index_map.at(name);
-        auto other_index = other.index_map.at(name);
+        auto this_index = this->index_map().at(name);
+        auto other_index = other.index_map().at(name);
         this->m_data[this_index] = other.m_data[other_index];
     }
 
@@ -132,18 +140,18 @@ public:
     }
 
     T& operator[](const std::string& name) {
-        auto index = this->index_map.at(name);
+        auto index = this->index_map().at(name);
         return this->m_data[index];
     }
 
     const T& operator[](const std::string& name) const {
-        auto index = this->index_map.at(name);
+        auto index = this->index_map().at(name);
         return this->m_data[index];
     }
 
     void clear() {
         this->m_data.clear();
-        this->index_map.clear();
+        this->index_map_ptr = std::make_shared<IndexMap>();
     }
 
     typename std::vector<T>::const_iterator begin() const {
@@ -159,18 +167,54 @@ public:
     }
 
     std::optional<int> well_index(const std::string& wname) const {
-        auto index_iter = this->index_map.find(wname);
-        if (index_iter != this->index_map.end())
+        auto index_iter = this->index_map().find(wname);
+        if (index_iter != this->index_map().end())
             return index_iter->second;
 
         return std::nullopt;
     }
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer.template vector<T, hasSerializeOp<Serializer>(0)>(this->m_data);
+        serializer(this->mutable_index_map());
+    }
+
 
 private:
+    using IndexMap = std::unordered_map<std::string, std::size_t>;
+
+    const IndexMap& index_map() const {
+        static const IndexMap empty_map;
+        return this->index_map_ptr ? *this->index_map_ptr : empty_map;
+    }
+
+    // The index map for modification, unshared first if necessary.
+    IndexMap& mutable_index_map() {
+        if (!this->index_map_ptr)
+            this->index_map_ptr = std::make_shared<IndexMap>();
+        else if (this->index_map_ptr.use_count() > 1)
+            this->index_map_ptr = std::make_shared<IndexMap>(*this->index_map_ptr);
+        return *this->index_map_ptr;
+    }
+
+    template<class Serializer, class U = T>
+    static constexpr auto hasSerializeOp(int)
+        -> decltype(std::declval<U&>().serializeOp(std::declval<Serializer&>()), bool())
+    {
+        return true;
+    }
+
+    template<class Serializer>
+    static constexpr bool hasSerializeOp(...)
+    {
+        return false;
+    }
+
     void update_if(std::size_t index, const std::string& name, const WellContainer<T>& other) {
-        auto other_iter = other.index_map.find(name);
-        if (other_iter == other.index_map.end())
+        auto other_iter = other.index_map().find(name);
+        if (other_iter == other.index_map().end())
             return;
 
         auto other_index = other_iter->second;
@@ -179,7 +223,7 @@ private:
 
 
     std::vector<T> m_data;
-    std::unordered_map<std::string, std::size_t> index_map;
+    std::shared_ptr<IndexMap> index_map_ptr = std::make_shared<IndexMap>();
 };
 
 
@@ -33,6 +33,8 @@
 #include <dune/common/dynmatrix.hh>
 #include <dune/common/parallel/mpihelper.hh>
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 namespace Opm {
@@ -154,6 +156,23 @@ namespace Opm {
             return dp;
         }
 
+        /// \brief Checks whether values are equal to previous ones up to a relative tolerance
+        ///
+        /// Used to decide whether results computed from the previous values
+        /// can be reused. The tolerance is relative to the magnitude of the
+        /// previous value, but at least one. A tolerance of zero only accepts
+        /// identical values.
+        inline
+        bool withinRelativeTolerance(const std::vector<double>& values,
+                                     const std::vector<double>& previous,
+                                     const double tolerance)
+        {
+            return values.size() == previous.size()
+                && std::equal(values.begin(), values.end(), previous.begin(),
+                              [tolerance](const double value, const double prev)
+                              { return std::abs(value - prev) <= tolerance * std::max(std::abs(prev), 1.0); });
+        }
+
 
 
         /// \brief Sums entries of the diagonal Matrix for distributed wells
@@ -189,8 +189,10 @@ public:
     virtual void apply(BVector& r) const = 0;
 
     // TODO: before we decide to put more information under mutable, this function is not const
+    // well_state is a copy of the current well state, the entries of this well may be
+    // modified during the computation and are to be reset by the caller
     virtual void computeWellPotentials(const Simulator& ebosSimulator,
-                                       const WellState& well_state,
+                                       WellState& well_state,
                                        std::vector<double>& well_potentials,
                                        DeferredLogger& deferred_logger) = 0;
 
@@ -349,6 +351,40 @@ protected:
                              DeferredLogger& deferred_logger);
 
     bool shutUnsolvableWells() const;
+
+    using JacobianBlock = typename SparseMatrixAdapter::MatrixBlock;
+
+    // The blocks of the reservoir matrix at the (row, column) cell pairs
+    // that forEachCellPair(visit) passes to visit. The blocks are looked up
+    // once per matrix, after that adding the well contributions is a plain
+    // scatter without searching the matrix rows. The pairs must be listed in
+    // the same order in every call, which holds since the sparsity of the
+    // well matrices is fixed after init().
+    template <class ForEachCellPair>
+    const std::vector<JacobianBlock*>& jacobianBlocks(SparseMatrixAdapter& jacobian,
+                                                      ForEachCellPair&& forEachCellPair) const
+    {
+        auto& matrix = jacobian.istlMatrix();
+        const JacobianBlock* storage = matrix.N() > 0 ? &*matrix[0].begin() : nullptr;
+        if (&matrix != jacobianBlocksMatrix_ || storage != jacobianBlocksStorage_ ||
+            matrix.nonzeroes() != jacobianBlocksNonzeroes_)
+        {
+            jacobianBlocks_.clear();
+            forEachCellPair([&](int row, int col) {
+                jacobianBlocks_.push_back(&matrix[row][col]);
+            });
+            jacobianBlocksMatrix_ = &matrix;
+            jacobianBlocksStorage_ = storage;
+            jacobianBlocksNonzeroes_ = matrix.nonzeroes();
+        }
+        return jacobianBlocks_;
+    }
+
+private:
+    mutable std::vector<JacobianBlock*> jacobianBlocks_;
+    mutable const void* jacobianBlocksMatrix_ = nullptr;
+    mutable const JacobianBlock* jacobianBlocksStorage_ = nullptr;
+    mutable std::size_t jacobianBlocksNonzeroes_ = 0;
 };
 
 }
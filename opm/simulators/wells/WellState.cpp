@@ -881,6 +881,25 @@ void WellState::updateStatus(int well_index, Well::Status status)
     }
 }
 
+void WellState::copyWellData(const WellState& other, std::size_t well_index)
+{
+    this->status_[well_index] = other.status_[well_index];
+    this->bhp_[well_index] = other.bhp_[well_index];
+    this->thp_[well_index] = other.thp_[well_index];
+    this->temperature_[well_index] = other.temperature_[well_index];
+    this->wellrates_[well_index] = other.wellrates_[well_index];
+    this->perfdata[well_index] = other.perfdata[well_index];
+    this->current_injection_controls_[well_index] = other.current_injection_controls_[well_index];
+    this->current_production_controls_[well_index] = other.current_production_controls_[well_index];
+    this->well_reservoir_rates_[well_index] = other.well_reservoir_rates_[well_index];
+    this->well_dissolved_gas_rates_[well_index] = other.well_dissolved_gas_rates_[well_index];
+    this->well_vaporized_oil_rates_[well_index] = other.well_vaporized_oil_rates_[well_index];
+    this->events_[well_index] = other.events_[well_index];
+    this->segment_state[well_index] = other.segment_state[well_index];
+    this->productivity_index_[well_index] = other.productivity_index_[well_index];
+    this->well_potentials_[well_index] = other.well_potentials_[well_index];
+}
+
 
 
 template<class Comm>
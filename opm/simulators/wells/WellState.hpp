@@ -294,6 +294,11 @@ public:
     void shutWell(int well_index);
     void stopWell(int well_index);
 
+    /// Copy the dynamic state of a single well from another well state
+    /// with the same wells, e.g. to reset the entries of a well in a
+    /// scratch copy after a computation which modified them.
+    void copyWellData(const WellState& other, std::size_t well_index);
+
     /// The number of phases present.
     int numPhases() const
     {
@@ -339,6 +344,34 @@ public:
         return this->perfdata[well_index];
     }
 
+    /// The dynamic state of the wells for checkpointing. The global well
+    /// information, perforation data and parallel well information are not
+    /// included, they are set up again by init() from the schedule.
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(wellMap_);
+        alq_state.serializeOp(serializer);
+        serializer(do_glift_optimization_);
+        status_.serializeOp(serializer);
+        bhp_.serializeOp(serializer);
+        thp_.serializeOp(serializer);
+        temperature_.serializeOp(serializer);
+        wellrates_.serializeOp(serializer);
+        perfdata.serializeOp(serializer);
+        is_producer_.serializeOp(serializer);
+        current_injection_controls_.serializeOp(serializer);
+        current_production_controls_.serializeOp(serializer);
+        serializer(well_rates);
+        well_reservoir_rates_.serializeOp(serializer);
+        well_dissolved_gas_rates_.serializeOp(serializer);
+        well_vaporized_oil_rates_.serializeOp(serializer);
+        events_.serializeOp(serializer);
+        segment_state.serializeOp(serializer);
+        productivity_index_.serializeOp(serializer);
+        well_potentials_.serializeOp(serializer);
+    }
+
 private:
     WellMapType wellMap_;
     // Use of std::optional<> here is a technical crutch, the
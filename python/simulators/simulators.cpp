@@ -32,17 +32,56 @@
 // NOTE: EXIT_SUCCESS, EXIT_FAILURE is defined in cstdlib
 #include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
 #include <string>
 #include <opm/simulators/flow/python/simulators.hpp>
 
 namespace py = pybind11;
 
+namespace {
+
+template <class T>
+std::shared_ptr<T> checkedInput(std::shared_ptr<T> input, const char* name)
+{
+    if (!input) {
+        throw std::invalid_argument(std::string("BlackOilSimulator: ") + name + " must not be None");
+    }
+    return input;
+}
+
+// The parsed input objects of opm.io are held by unique pointers on the
+// Python side, they are thus taken by pointer (None becomes nullptr) and
+// copied, which the simulator does in any case.
+template <class T>
+std::shared_ptr<T> copyInput(const T* input, const char* name)
+{
+    if (!input) {
+        throw std::invalid_argument(std::string("BlackOilSimulator: ") + name + " must not be None");
+    }
+    return std::make_shared<T>(*input);
+}
+
+} // anonymous namespace
+
 namespace Opm::Pybind {
 BlackOilSimulator::BlackOilSimulator( const std::string &deckFilename)
     : deckFilename_{deckFilename}
 {
 }
 
+BlackOilSimulator::BlackOilSimulator( std::shared_ptr<Opm::Deck> deck,
+                                      std::shared_ptr<Opm::EclipseState> state,
+                                      std::shared_ptr<Opm::Schedule> schedule,
+                                      std::shared_ptr<Opm::SummaryConfig> summaryConfig)
+    : deckFilename_{checkedInput(state, "state")->getIOConfig().fullBasePath()}
+    , deck_{checkedInput(std::move(deck), "deck")}
+    , eclipseState_{std::move(state)}
+    , schedule_{checkedInput(std::move(schedule), "schedule")}
+    , summaryConfig_{checkedInput(std::move(summaryConfig), "summary_config")}
+{
+}
+
 py::array_t<double> BlackOilSimulator::getPorosity()
 {
     std::size_t len;
@@ -52,8 +91,8 @@ py::array_t<double> BlackOilSimulator::getPorosity()
 
 int BlackOilSimulator::run()
 {
-    auto mainObject = Opm::Main( deckFilename_ );
-    return mainObject.runDynamic();
+    auto mainObject = makeMain_();
+    return mainObject->runDynamic();
 }
 
 void BlackOilSimulator::setPorosity( py::array_t<double,
@@ -93,7 +132,7 @@ int BlackOilSimulator::stepInit()
             return EXIT_SUCCESS;
         }
     }
-    main_ = std::make_unique<Opm::Main>( deckFilename_ );
+    main_ = makeMain_();
     int exitCode = EXIT_SUCCESS;
     mainEbos_ = main_->initFlowEbosBlackoil(exitCode);
     if (mainEbos_) {
@@ -109,6 +148,15 @@ int BlackOilSimulator::stepInit()
     }
 }
 
+std::unique_ptr<Opm::Main> BlackOilSimulator::makeMain_() const
+{
+    if (eclipseState_) {
+        return std::make_unique<Opm::Main>( deckFilename_, deck_, eclipseState_,
+                                            schedule_, summaryConfig_ );
+    }
+    return std::make_unique<Opm::Main>( deckFilename_ );
+}
+
 } // namespace Opm::Pybind
 
 PYBIND11_MODULE(simulators, m)
@@ -116,6 +164,17 @@ PYBIND11_MODULE(simulators, m)
     using namespace Opm::Pybind;
     py::class_<BlackOilSimulator>(m, "BlackOilSimulator")
         .def(py::init< const std::string& >())
+        .def(py::init([](const Opm::Deck* deck,
+                         const Opm::EclipseState* state,
+                         const Opm::Schedule* schedule,
+                         const Opm::SummaryConfig* summaryConfig)
+             {
+                 return std::make_unique<BlackOilSimulator>(
+                     copyInput(deck, "deck"), copyInput(state, "state"),
+                     copyInput(schedule, "schedule"), copyInput(summaryConfig, "summary_config"));
+             }),
+             py::arg("deck"), py::arg("state"),
+             py::arg("schedule"), py::arg("summary_config"))
         .def("get_porosity", &BlackOilSimulator::getPorosity,
             py::return_value_policy::copy)
         .def("run", &BlackOilSimulator::run)
@@ -0,0 +1,50 @@
+import os
+import unittest
+from contextlib import contextmanager
+from pathlib import Path
+from opm2.simulators import BlackOilSimulator
+
+try:
+    from opm.io.parser import Parser
+    from opm.io.ecl_state import EclipseState
+    from opm.io.schedule import Schedule
+    from opm.io.summary import SummaryConfig
+    HAVE_OPM_IO = True
+except ImportError:
+    HAVE_OPM_IO = False
+
+@contextmanager
+def pushd(path):
+    cwd = os.getcwd()
+    if not os.path.isdir(path):
+        os.makedirs(path)
+    os.chdir(path)
+    yield
+    os.chdir(cwd)
+
+
+# NOTE: Only one simulator object can be created per process, see the note in
+#   test_basic.py, this test is thus run by a Python process of its own.
+@unittest.skipUnless(HAVE_OPM_IO, "the opm.io Python package is not available")
+class TestParsedObjects(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        test_dir = Path(os.path.dirname(__file__))
+        cls.data_dir = test_dir.parent.joinpath("test_data/SPE1CASE1")
+
+    def test_all(self):
+        with pushd(self.data_dir):
+            deck = Parser().parse("SPE1CASE1.DATA")
+            state = EclipseState(deck)
+            schedule = Schedule(deck, state)
+            summary_config = SummaryConfig(deck, state, schedule)
+
+            with self.assertRaises(ValueError):
+                BlackOilSimulator(deck, None, schedule, summary_config)
+
+            sim = BlackOilSimulator(deck, state, schedule, summary_config)
+            sim.step_init()
+            sim.step()
+            poro = sim.get_porosity()
+            self.assertEqual(len(poro), 300, 'length of porosity vector')
+            self.assertAlmostEqual(poro[0], 0.3, places=7, msg='value of porosity')
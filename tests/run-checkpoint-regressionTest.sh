@@ -0,0 +1,68 @@
+#!/bin/bash
+
+# This runs a simulator from start to end while writing checkpoints, then
+# resumes a second run from the last checkpoint written by the first one,
+# before comparing the output from the two runs. This is meant to track
+# regressions in the checkpoint support.
+
+INPUT_DATA_PATH="$1"
+RESULT_PATH="$2"
+BINPATH="$3"
+FILENAME="$4"
+ABS_TOL="$5"
+REL_TOL="$6"
+COMPARE_ECL_COMMAND="$7"
+CHECKPOINT_INTERVAL="$8"
+FAULT="$9"
+EXE_NAME="${10}"
+shift 10
+TEST_ARGS="$@"
+
+RESUMED_PATH=${RESULT_PATH}/resumed
+DECK=${INPUT_DATA_PATH}/${FILENAME}
+
+rm -Rf ${RESULT_PATH}
+mkdir -p ${RESULT_PATH}
+cd ${RESULT_PATH}
+
+# Unless FAULT is "none" it gives the box "I1 I2 J1 J2 K1 K2 FACE" of a fault
+# which is added to the grid, and whose transmissibility multiplier is changed
+# at the start of the SCHEDULE section, i.e. before any checkpoint is written.
+if [ "${FAULT}" != "none" ]
+then
+  DECK=${RESULT_PATH}/${FILENAME}.DATA
+  sed -e "/^GRID/a FAULTS\n  'CHKFLT' ${FAULT} /\n/" \
+      -e "/^SCHEDULE/a MULTFLT\n  'CHKFLT' 0.1 /\n/" \
+      ${INPUT_DATA_PATH}/${FILENAME}.DATA > ${DECK}
+fi
+
+${BINPATH}/${EXE_NAME} ${DECK} --output-dir=${RESULT_PATH} --checkpoint-interval=${CHECKPOINT_INTERVAL} ${TEST_ARGS}
+
+test $? -eq 0 || exit 1
+
+# The uninterrupted run has moved on after writing its last checkpoint,
+# continuing from it emulates a run which was stopped at that point.
+mkdir -p ${RESUMED_PATH}
+cp ${RESULT_PATH}/${FILENAME}.CHECKPOINT.* ${RESUMED_PATH}/ || exit 1
+
+${BINPATH}/${EXE_NAME} ${DECK} --output-dir=${RESUMED_PATH} --restart-from-checkpoint=true ${TEST_ARGS}
+test $? -eq 0 || exit 1
+
+ecode=0
+echo "=== Executing comparison for summary file ==="
+${COMPARE_ECL_COMMAND} -R -t SMRY ${RESULT_PATH}/${FILENAME} ${RESUMED_PATH}/${FILENAME} ${ABS_TOL} ${REL_TOL}
+if [ $? -ne 0 ]
+then
+  ecode=1
+  ${COMPARE_ECL_COMMAND} -a -R -t SMRY ${RESULT_PATH}/${FILENAME} ${RESUMED_PATH}/${FILENAME} ${ABS_TOL} ${REL_TOL}
+fi
+
+echo "=== Executing comparison for restart file ==="
+${COMPARE_ECL_COMMAND} -l -t UNRST ${RESULT_PATH}/${FILENAME} ${RESUMED_PATH}/${FILENAME} ${ABS_TOL} ${REL_TOL}
+if [ $? -ne 0 ]
+then
+  ecode=1
+  ${COMPARE_ECL_COMMAND} -a -l -t UNRST ${RESULT_PATH}/${FILENAME} ${RESUMED_PATH}/${FILENAME} ${ABS_TOL} ${REL_TOL}
+fi
+
+exit $ecode
@@ -119,6 +119,8 @@
 #include <opm/output/data/Aquifer.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
 #include <opm/simulators/utils/ParallelRestart.hpp>
+#include <opm/simulators/wells/ALQState.hpp>
+#include <opm/simulators/wells/GroupState.hpp>
 #include <ebos/eclmpiserializer.hh>
 
 
@@ -537,6 +539,47 @@ BOOST_AUTO_TEST_CASE(RestartValue)
     DO_CHECKS(RestartValue)
 }
 
+BOOST_AUTO_TEST_CASE(GroupState)
+{
+    Opm::GroupState val1(3);
+    val1.update_production_rates("AGROUP", {1.0, 2.0, 3.0});
+    val1.update_injection_rein_rates("CGROUP", {4.0, 5.0, 6.0});
+    val1.production_control("AGROUP", Opm::Group::ProductionCMode::GRAT);
+    val1.injection_control("AGROUP", Opm::Phase::WATER, Opm::Group::InjectionCMode::RATE);
+    val1.update_injection_vrep_rate("BGROUP", 7.0);
+
+    auto comm = Dune::MPIHelper::getCollectiveCommunication();
+    Opm::EclMpiSerializer ser(comm);
+    ser.pack(val1);
+    const std::size_t pos1 = ser.position();
+    Opm::GroupState val2(3);
+    ser.unpack(val2);
+    const std::size_t pos2 = ser.position();
+    BOOST_CHECK_MESSAGE(pos1 == pos2, "Packed size differ from unpack size for GroupState");
+    BOOST_CHECK_MESSAGE(val1 == val2, "Deserialized GroupState differ");
+}
+
+BOOST_AUTO_TEST_CASE(ALQState)
+{
+    Opm::ALQState val1;
+    val1.update_default("W1", 10.0);
+    val1.set("W1", 12.5);
+    val1.update_count("W1", true);
+    val1.update_count("W2", false);
+
+    auto comm = Dune::MPIHelper::getCollectiveCommunication();
+    Opm::EclMpiSerializer ser(comm);
+    ser.pack(val1);
+    const std::size_t pos1 = ser.position();
+    Opm::ALQState val2;
+    ser.unpack(val2);
+    const std::size_t pos2 = ser.position();
+    BOOST_CHECK_MESSAGE(pos1 == pos2, "Packed size differ from unpack size for ALQState");
+    BOOST_CHECK_EQUAL(val2.get("W1"), 12.5);
+    BOOST_CHECK_EQUAL(val2.get_increment_count("W1"), 1);
+    BOOST_CHECK_EQUAL(val2.get_decrement_count("W2"), 1);
+}
+
 #define TEST_FOR_TYPE(TYPE) \
 BOOST_AUTO_TEST_CASE(TYPE) \
 { \
@@ -0,0 +1,122 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE TestEclMpiSerializer
+#define BOOST_TEST_NO_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include <ebos/eclmpiserializer.hh>
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <vector>
+
+bool
+init_unit_test_func()
+{
+    return true;
+}
+
+namespace
+{
+
+struct Payload
+{
+    std::vector<double> values;
+    int tag = 0;
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(values);
+        serializer(tag);
+    }
+};
+
+Payload makePayload(std::size_t size, int tag)
+{
+    Payload payload;
+    payload.tag = tag;
+    for (std::size_t i = 0; i < size; ++i)
+        payload.values.push_back(tag + 0.5 * i);
+    return payload;
+}
+
+// Broadcasts payloads of growing and shrinking size with one serializer,
+// such that the shared memory window is both reused and reallocated.
+void checkBroadcasts(Opm::EclMpiSerializer& ser)
+{
+    auto cc = Dune::MPIHelper::getCollectiveCommunication();
+    for (const auto& [size, tag] : {std::pair{10, 1}, std::pair{100000, 2},
+                                     std::pair{5, 3}, std::pair{0, 4}})
+    {
+        const auto expected = makePayload(size, tag);
+        Payload payload = cc.rank() == 0 ? expected : Payload{};
+        Payload second = cc.rank() == 0 ? makePayload(3, -tag) : Payload{};
+        ser.broadcast(payload, second);
+
+        BOOST_CHECK_EQUAL(payload.tag, tag);
+        BOOST_CHECK_EQUAL_COLLECTIONS(payload.values.begin(), payload.values.end(),
+                                      expected.values.begin(), expected.values.end());
+        BOOST_CHECK_EQUAL(second.tag, -tag);
+        BOOST_CHECK_EQUAL(second.values.size(), 3u);
+    }
+}
+
+// Emulates nodes of the given number of processes on one machine.
+MPI_Comm splitNodes(int processesPerNode)
+{
+    auto cc = Dune::MPIHelper::getCollectiveCommunication();
+    MPI_Comm nodeComm;
+    MPI_Comm_split(cc, cc.rank() / processesPerNode, cc.rank(), &nodeComm);
+    return nodeComm;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(SharedMemoryNodes)
+{
+    Opm::EclMpiSerializer ser(Dune::MPIHelper::getCollectiveCommunication());
+    checkBroadcasts(ser);
+}
+
+BOOST_AUTO_TEST_CASE(SeveralNodes)
+{
+    // the leaders of all but the first node are not the root process
+    MPI_Comm nodeComm = splitNodes(2);
+    Opm::EclMpiSerializer ser(Dune::MPIHelper::getCollectiveCommunication(), nodeComm);
+    MPI_Comm_free(&nodeComm);
+    checkBroadcasts(ser);
+}
+
+BOOST_AUTO_TEST_CASE(OneProcessPerNode)
+{
+    MPI_Comm nodeComm = splitNodes(1);
+    Opm::EclMpiSerializer ser(Dune::MPIHelper::getCollectiveCommunication(), nodeComm);
+    MPI_Comm_free(&nodeComm);
+    checkBroadcasts(ser);
+}
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+    return boost::unit_test::unit_test_main(&init_unit_test_func, argc, argv);
+}
@@ -0,0 +1,189 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE GasLiftGradQueue
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/wells/GasLiftStage2.hpp>
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using GradQueue = Opm::GasLiftStage2::GradQueue;
+using GradPair = std::pair<std::string, double>;
+
+namespace
+{
+
+// The selection done before the gradients were kept in a heap: sort the
+// gradients by value, take the largest incremental gradient and the
+// smallest decremental gradient of another well. Ties were left to
+// std::sort, they are resolved by well name here as in GradQueue.
+std::pair<std::optional<GradPair>, std::optional<GradPair>>
+sortBasedSelection(const std::map<std::string, double>& inc,
+                   const std::map<std::string, double>& dec)
+{
+    auto cmp = [](const GradPair& a, const GradPair& b)
+    {
+        return a.second != b.second ? a.second < b.second : a.first > b.first;
+    };
+    std::vector<GradPair> inc_grads(inc.begin(), inc.end());
+    std::vector<GradPair> dec_grads(dec.begin(), dec.end());
+    std::sort(inc_grads.begin(), inc_grads.end(), cmp);
+    std::sort(dec_grads.begin(), dec_grads.end(), [](const GradPair& a, const GradPair& b)
+              { return a.second != b.second ? a.second < b.second : a.first < b.first; });
+    if (inc_grads.empty())
+        return {std::nullopt, std::nullopt};
+    const auto& inc_grad = inc_grads.back();
+    for (const auto& dec_grad : dec_grads) {
+        if (dec_grad.first != inc_grad.first)
+            return {dec_grad, inc_grad};
+    }
+    return {std::nullopt, std::nullopt};
+}
+
+std::pair<std::optional<GradPair>, std::optional<GradPair>>
+queueSelection(GradQueue& inc_grads, GradQueue& dec_grads)
+{
+    auto inc_grad = inc_grads.top();
+    if (inc_grad) {
+        auto dec_grad = dec_grads.topExcluding(inc_grad->first);
+        if (dec_grad)
+            return {dec_grad, inc_grad};
+    }
+    return {std::nullopt, std::nullopt};
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(StaleEntriesAreSkipped)
+{
+    GradQueue grads{/*largest_first=*/true};
+    grads.assign({{"W1", 1.0}, {"W2", 2.0}, {"W3", 3.0}});
+    BOOST_CHECK(*grads.top() == GradPair("W3", 3.0));
+
+    // the old entries of W3 are still in the heap, but outdated
+    grads.set("W3", 5.0);
+    grads.set("W3", 0.5);
+    BOOST_CHECK(*grads.top() == GradPair("W2", 2.0));
+    BOOST_CHECK_EQUAL(grads.size(), 3u);
+    BOOST_CHECK_EQUAL(*grads.get("W3"), 0.5);
+
+    grads.erase("W2");
+    BOOST_CHECK(*grads.top() == GradPair("W1", 1.0));
+    BOOST_CHECK(!grads.get("W2"));
+    grads.erase("W1");
+    grads.erase("W3");
+    BOOST_CHECK_EQUAL(grads.size(), 0u);
+    BOOST_CHECK(!grads.top());
+    BOOST_CHECK(!grads.topExcluding("W1"));
+}
+
+BOOST_AUTO_TEST_CASE(ReinsertionAfterGradientUpdate)
+{
+    GradQueue grads{/*largest_first=*/false};
+    grads.assign({{"W1", 1.0}, {"W2", 2.0}});
+    BOOST_CHECK(*grads.top() == GradPair("W1", 1.0));
+
+    // a well removed from the queue comes back with its new gradient, and
+    // not with the outdated entry still stored in the heap
+    grads.erase("W1");
+    BOOST_CHECK(*grads.top() == GradPair("W2", 2.0));
+    grads.set("W1", 3.0);
+    BOOST_CHECK(*grads.top() == GradPair("W2", 2.0));
+    BOOST_CHECK(*grads.topExcluding("W2") == GradPair("W1", 3.0));
+    grads.set("W1", 1.5);
+    BOOST_CHECK(*grads.top() == GradPair("W1", 1.5));
+
+    // topExcluding leaves the queue unchanged
+    BOOST_CHECK(*grads.topExcluding("W1") == GradPair("W2", 2.0));
+    BOOST_CHECK(*grads.top() == GradPair("W1", 1.5));
+    BOOST_CHECK(*grads.topExcluding("W3") == GradPair("W1", 1.5));
+
+    // many updates of the same well trigger rebuilds of the heap
+    for (int i = 0; i < 100; ++i)
+        grads.set("W2", 10.0 - 0.05 * i);
+    BOOST_CHECK_EQUAL(grads.size(), 2u);
+    BOOST_CHECK(*grads.top() == GradPair("W1", 1.5));
+    grads.erase("W1");
+    BOOST_CHECK_CLOSE(grads.top()->second, 10.0 - 0.05 * 99, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(TiesAreOrderedByName)
+{
+    GradQueue inc_grads{/*largest_first=*/true};
+    GradQueue dec_grads{/*largest_first=*/false};
+    inc_grads.assign({{"C", 2.0}, {"A", 2.0}, {"B", 1.0}});
+    dec_grads.assign({{"C", 1.0}, {"B", 1.0}, {"A", 1.0}});
+    BOOST_CHECK(*inc_grads.top() == GradPair("A", 2.0));
+    BOOST_CHECK(*dec_grads.top() == GradPair("A", 1.0));
+    BOOST_CHECK(*dec_grads.topExcluding("A") == GradPair("B", 1.0));
+}
+
+// Random updates with few distinct values to get many ties, compared with
+// the selection by sorting after every update.
+BOOST_AUTO_TEST_CASE(SameSelectionAsSorting)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> well_dist(0, 7);
+    std::uniform_int_distribution<int> value_dist(0, 4);
+    std::uniform_int_distribution<int> op_dist(0, 9);
+
+    for (int run = 0; run < 20; ++run) {
+        std::map<std::string, double> inc, dec;
+        for (int w = 0; w < 8; ++w) {
+            const std::string name = "W" + std::to_string(w);
+            inc[name] = value_dist(gen);
+            dec[name] = value_dist(gen);
+        }
+        GradQueue inc_grads{/*largest_first=*/true};
+        GradQueue dec_grads{/*largest_first=*/false};
+        inc_grads.assign({inc.begin(), inc.end()});
+        dec_grads.assign({dec.begin(), dec.end()});
+
+        for (int step = 0; step < 200; ++step) {
+            const std::string name = "W" + std::to_string(well_dist(gen));
+            const bool increase = op_dist(gen) % 2 == 0;
+            auto& ref = increase ? inc : dec;
+            auto& queue = increase ? inc_grads : dec_grads;
+            if (op_dist(gen) == 0) {
+                ref.erase(name);
+                queue.erase(name);
+            }
+            else {
+                const double value = 0.5 * value_dist(gen);
+                ref[name] = value;
+                queue.set(name, value);
+            }
+
+            BOOST_REQUIRE_EQUAL(inc_grads.size(), inc.size());
+            BOOST_REQUIRE_EQUAL(dec_grads.size(), dec.size());
+            const auto expected = sortBasedSelection(inc, dec);
+            const auto actual = queueSelection(inc_grads, dec_grads);
+            BOOST_REQUIRE(expected == actual);
+        }
+    }
+}
@@ -0,0 +1,158 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE LinearSystemCaptureTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/linalg/LinearSystemCapture.hpp>
+#include <opm/simulators/linalg/MatrixBlock.hpp>
+
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+using Matrix = Dune::BCRSMatrix<Opm::MatrixBlock<double, 2, 2>>;
+using Vector = Dune::BlockVector<Dune::FieldVector<double, 2>>;
+
+namespace
+{
+
+// Tridiagonal matrix with distinct values in every entry.
+Matrix makeMatrix(int n, double offset)
+{
+    Matrix matrix(n, n, 3*n - 2, Matrix::row_wise);
+    for (auto row = matrix.createbegin(); row != matrix.createend(); ++row) {
+        const int i = row.index();
+        for (int j = std::max(0, i - 1); j <= std::min(n - 1, i + 1); ++j) {
+            row.insert(j);
+        }
+    }
+    for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+        for (auto col = row->begin(); col != row->end(); ++col) {
+            for (int k = 0; k < 2; ++k) {
+                for (int l = 0; l < 2; ++l) {
+                    (*col)[k][l] = offset + 10.0*row.index() + col.index() + 0.1*k + 0.01*l;
+                }
+            }
+        }
+    }
+    return matrix;
+}
+
+Vector makeVector(int n, double offset)
+{
+    Vector vector(n);
+    for (int i = 0; i < n; ++i) {
+        vector[i][0] = offset + i;
+        vector[i][1] = offset - 0.5*i;
+    }
+    return vector;
+}
+
+void checkEqual(const Matrix& a, const Matrix& b)
+{
+    BOOST_REQUIRE_EQUAL(a.N(), b.N());
+    BOOST_REQUIRE_EQUAL(a.nonzeroes(), b.nonzeroes());
+    for (auto row = a.begin(); row != a.end(); ++row) {
+        const auto& rowB = b[row.index()];
+        BOOST_REQUIRE_EQUAL(row->size(), rowB.size());
+        for (auto col = row->begin(), colB = rowB.begin(); col != row->end(); ++col, ++colB) {
+            BOOST_CHECK_EQUAL(col.index(), colB.index());
+            BOOST_CHECK_EQUAL(*col, *colB);
+        }
+    }
+}
+
+void checkEqual(const Vector& a, const Vector& b)
+{
+    BOOST_REQUIRE_EQUAL(a.size(), b.size());
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        BOOST_CHECK_EQUAL(a[i], b[i]);
+    }
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+    const std::string filename = "test_linearsystemcapture_full.bin";
+    const Matrix matrix = makeMatrix(5, 1.0);
+    const Matrix wellMatrix = makeMatrix(5, -3.0);
+    const Vector rhs = makeVector(5, 2.0);
+    const Vector weights = makeVector(5, 0.25);
+    Opm::LinearSystemCapture::write(filename, matrix, rhs, &wellMatrix, &weights);
+
+    BOOST_CHECK_EQUAL(Opm::LinearSystemCapture::blockSize(filename), 2);
+
+    Matrix matrixRead, wellMatrixRead;
+    Vector rhsRead, weightsRead;
+    Opm::LinearSystemCapture::read(filename, matrixRead, rhsRead, wellMatrixRead, weightsRead);
+    checkEqual(matrix, matrixRead);
+    checkEqual(wellMatrix, wellMatrixRead);
+    checkEqual(rhs, rhsRead);
+    checkEqual(weights, weightsRead);
+    std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(RoundTripWithoutOptionalParts)
+{
+    const std::string filename = "test_linearsystemcapture_plain.bin";
+    const Matrix matrix = makeMatrix(3, 0.0);
+    const Vector rhs = makeVector(3, 1.0);
+    Opm::LinearSystemCapture::write<Matrix, Vector>(filename, matrix, rhs, nullptr, nullptr);
+
+    Matrix matrixRead, wellMatrixRead;
+    Vector rhsRead, weightsRead;
+    Opm::LinearSystemCapture::read(filename, matrixRead, rhsRead, wellMatrixRead, weightsRead);
+    checkEqual(matrix, matrixRead);
+    checkEqual(rhs, rhsRead);
+    BOOST_CHECK_EQUAL(wellMatrixRead.N(), 0u);
+    BOOST_CHECK_EQUAL(weightsRead.size(), 0u);
+    std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(TruncatedCapture)
+{
+    const std::string filename = "test_linearsystemcapture_truncated.bin";
+    const Matrix matrix = makeMatrix(4, 0.0);
+    const Vector rhs = makeVector(4, 1.0);
+    Opm::LinearSystemCapture::write<Matrix, Vector>(filename, matrix, rhs, nullptr, nullptr);
+    {
+        std::ifstream is(filename, std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+        std::ofstream os(filename, std::ios::binary | std::ios::trunc);
+        os.write(content.data(), content.size() / 2);
+    }
+
+    Matrix matrixRead, wellMatrixRead;
+    Vector rhsRead, weightsRead;
+    BOOST_CHECK_THROW(Opm::LinearSystemCapture::read(filename, matrixRead, rhsRead,
+                                                     wellMatrixRead, weightsRead),
+                      std::runtime_error);
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,134 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE NonlinearSolverEbosTest
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/flow/FlowMainEbos.hpp>
+#include <opm/simulators/flow/NonlinearSolverEbos.hpp>
+
+#if HAVE_DUNE_FEM
+#include <dune/fem/misc/mpimanager.hh>
+#else
+#include <dune/common/parallel/mpihelper.hh>
+#endif
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+using TypeTag = Opm::Properties::TTag::EclFlowProblem;
+
+// The divergence check only looks at the residual history passed to it,
+// the model is never called.
+struct DummyModel {};
+
+using Solver = Opm::NonlinearSolverEbos<TypeTag, DummyModel>;
+
+struct GlobalFixture {
+    GlobalFixture()
+    {
+        int argcDummy = 1;
+        const char *tmp[] = {"test_nonlinearsolverebos"};
+        char **argvDummy = const_cast<char**>(tmp);
+
+#if HAVE_DUNE_FEM
+        Dune::Fem::MPIManager::initialize(argcDummy, argvDummy);
+#else
+        Dune::MPIHelper::instance(argcDummy, argvDummy);
+#endif
+
+        Opm::FlowMainEbos<TypeTag>::setupParameters_(argcDummy, argvDummy);
+    }
+};
+
+Solver makeSolver(int divergenceIterations)
+{
+    Solver::SolverParameters param;
+    param.divergenceIter_ = divergenceIterations;
+    param.divergenceFactor_ = 10.0;
+    param.stagnationTol_ = 1.0e-3;
+    return Solver(param, std::make_unique<DummyModel>());
+}
+
+// Residual history with the given largest norm per iteration, spread over
+// three phases with different signs.
+std::vector<std::vector<double>> history(const std::vector<double>& maxNorms)
+{
+    std::vector<std::vector<double>> result;
+    for (const double norm : maxNorms)
+        result.push_back({0.5 * norm, -norm, 0.0});
+    return result;
+}
+
+} // anonymous namespace
+
+BOOST_GLOBAL_FIXTURE(GlobalFixture);
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+    const auto solver = makeSolver(0);
+    BOOST_CHECK(!solver.detectDivergence(history({1.0, 0.1, 1.0, 10.0, 100.0}), 0));
+    BOOST_CHECK(!solver.detectDivergence(history({1.0, 1.0, 1.0, 1.0}), 0));
+    BOOST_CHECK(!solver.detectDivergence(history({1.0}), 5));
+}
+
+BOOST_AUTO_TEST_CASE(Diverging)
+{
+    const auto solver = makeSolver(3);
+    // grows in each of the last three iterations to 20 times the best iterate
+    BOOST_CHECK(solver.detectDivergence(history({1.0, 0.1, 0.5, 1.0, 2.0}), 0));
+    // grows, but stays below ten times the best iterate
+    BOOST_CHECK(!solver.detectDivergence(history({1.0, 0.5, 0.6, 0.7, 0.8}), 0));
+    // large, but the growth was interrupted within the window
+    BOOST_CHECK(!solver.detectDivergence(history({1.0, 0.1, 0.5, 0.4, 2.0}), 0));
+    // grows for fewer iterations than the window
+    BOOST_CHECK(!solver.detectDivergence(history({0.1, 1.0, 10.0}), 0));
+}
+
+BOOST_AUTO_TEST_CASE(Stagnating)
+{
+    const auto solver = makeSolver(3);
+    BOOST_CHECK(solver.detectDivergence(history({1.0, 0.5, 0.5, 0.5, 0.5}), 0));
+    BOOST_CHECK(solver.detectDivergence(history({1.0, 0.5, 0.5001, 0.5002, 0.5001}), 0));
+    // one iteration with a significant change is enough to continue
+    BOOST_CHECK(!solver.detectDivergence(history({1.0, 0.5, 0.5, 0.4, 0.4}), 0));
+    // not enough iterations to judge
+    BOOST_CHECK(!solver.detectDivergence(history({0.5, 0.5, 0.5}), 0));
+}
+
+BOOST_AUTO_TEST_CASE(Converging)
+{
+    const auto solver = makeSolver(3);
+    BOOST_CHECK(!solver.detectDivergence(history({1.0, 0.5, 0.25, 0.125, 0.0625}), 0));
+    BOOST_CHECK(!solver.detectDivergence(history({1.0, 0.1, 0.2, 0.05, 0.01, 0.001}), 0));
+}
+
+BOOST_AUTO_TEST_CASE(LinearSolverFailures)
+{
+    const auto solver = makeSolver(3);
+    BOOST_CHECK(solver.detectDivergence(history({1.0}), 3));
+    BOOST_CHECK(solver.detectDivergence(history({1.0, 0.5, 0.25, 0.125}), 4));
+    BOOST_CHECK(!solver.detectDivergence(history({1.0, 0.5, 0.25, 0.125}), 2));
+}
@@ -0,0 +1,166 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE TestSharedMemoryHaloExchange
+#define BOOST_TEST_NO_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/linalg/SharedMemoryHaloExchange.hpp>
+#include <dune/common/fvector.hh>
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/istl/owneroverlapcopy.hh>
+
+#include <vector>
+
+bool
+init_unit_test_func()
+{
+    return true;
+}
+
+namespace
+{
+
+// Each process owns the entries 1..10 of a one dimensional grid with a copy
+// of the last entry of the previous and the first entry of the next process
+// at 0 and 11.
+std::vector<Opm::SharedMemoryHaloExchange::Neighbour> chainNeighbours(int rank, int size)
+{
+    std::vector<Opm::SharedMemoryHaloExchange::Neighbour> neighbours;
+    if (rank > 0)
+        neighbours.push_back({rank - 1, {1}, {0}});
+    if (rank < size - 1)
+        neighbours.push_back({rank + 1, {10}, {11}});
+    return neighbours;
+}
+
+void checkExchange(bool useSharedMemory)
+{
+    auto cc = Dune::MPIHelper::getCollectiveCommunication();
+    const int rank = cc.rank();
+    const int size = cc.size();
+    Opm::SharedMemoryHaloExchange exchange(chainNeighbours(rank, size), cc, useSharedMemory);
+
+    // several exchanges with changing values, consecutive exchanges with the
+    // same block size alternate between the two halves of the window
+    for (int step = 0; step < 9; ++step) {
+        Dune::BlockVector<Dune::FieldVector<double, 2>> blocks(12);
+        std::vector<double> values(12, -1.0);
+        blocks = -1.0;
+        for (int i = 1; i <= 10; ++i) {
+            const double global = rank * 10 + i - 1;
+            blocks[i][0] = step;
+            blocks[i][1] = global;
+            values[i] = 100 * step + global;
+        }
+        if ((step / 3) % 2 == 0) {
+            exchange.copyOwnerToAll(blocks, blocks);
+            if (rank > 0) {
+                BOOST_CHECK_EQUAL(blocks[0][0], step);
+                BOOST_CHECK_EQUAL(blocks[0][1], rank * 10 - 1);
+            }
+            if (rank < size - 1) {
+                BOOST_CHECK_EQUAL(blocks[11][0], step);
+                BOOST_CHECK_EQUAL(blocks[11][1], rank * 10 + 10);
+            }
+        } else {
+            exchange.copyOwnerToAll(values, values);
+            BOOST_CHECK_EQUAL(values[0], rank > 0 ? 100 * step + rank * 10 - 1 : -1.0);
+            BOOST_CHECK_EQUAL(values[11], rank < size - 1 ? 100 * step + rank * 10 + 10 : -1.0);
+        }
+    }
+}
+
+// The same grid as above as the index set of an owner overlap copy
+// communication, the result is compared with its copyOwnerToAll().
+void checkRemoteIndices(bool useSharedMemory)
+{
+    using Communication = Dune::OwnerOverlapCopyCommunication<int, int>;
+    using LocalIndex = Communication::ParallelIndexSet::LocalIndex;
+    constexpr auto owner = Dune::OwnerOverlapCopyAttributeSet::owner;
+    constexpr auto copy = Dune::OwnerOverlapCopyAttributeSet::copy;
+
+    auto cc = Dune::MPIHelper::getCollectiveCommunication();
+    const int rank = cc.rank();
+    const int size = cc.size();
+    Communication comm(cc);
+    auto& indices = comm.indexSet();
+    indices.beginResize();
+    for (int i = 0; i < 12; ++i) {
+        if ((i == 0 && rank == 0) || (i == 11 && rank == size - 1))
+            continue;
+        const bool owned = i >= 1 && i <= 10;
+        indices.add(rank * 10 + i - 1, LocalIndex(i, owned ? owner : copy, true));
+    }
+    indices.endResize();
+    comm.remoteIndices().rebuild<false>();
+
+    const auto neighbours =
+        Opm::SharedMemoryHaloExchange::neighboursFromRemoteIndices(comm.remoteIndices());
+    BOOST_CHECK_EQUAL(neighbours.size(), chainNeighbours(rank, size).size());
+    Opm::SharedMemoryHaloExchange exchange(comm.remoteIndices(), cc, useSharedMemory);
+
+    for (int step = 0; step < 3; ++step) {
+        Dune::BlockVector<Dune::FieldVector<double, 3>> expected(12), actual(12);
+        expected = -1.0;
+        for (int i = 1; i <= 10; ++i) {
+            expected[i][0] = step;
+            expected[i][1] = rank;
+            expected[i][2] = rank * 10 + i - 1;
+        }
+        actual = expected;
+        comm.copyOwnerToAll(expected, expected);
+        exchange.copyOwnerToAll(actual, actual);
+        for (int i = 0; i < 12; ++i)
+            for (int k = 0; k < 3; ++k)
+                BOOST_CHECK_EQUAL(actual[i][k], expected[i][k]);
+    }
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(SharedMemory)
+{
+    checkExchange(true);
+}
+
+BOOST_AUTO_TEST_CASE(Messages)
+{
+    checkExchange(false);
+}
+
+BOOST_AUTO_TEST_CASE(RemoteIndicesSharedMemory)
+{
+    checkRemoteIndices(true);
+}
+
+BOOST_AUTO_TEST_CASE(RemoteIndicesMessages)
+{
+    checkRemoteIndices(false);
+}
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+    return boost::unit_test::unit_test_main(&init_unit_test_func, argc, argv);
+}
@@ -365,6 +365,30 @@ BOOST_AUTO_TEST_CASE(STOP_well)
 }
 
 
+// ---------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(CopyWellData)
+{
+    const Setup setup{ "msw.data" };
+
+    std::vector<Opm::ParallelWellInfo> pinfos;
+    auto wstate = buildWellState(setup, 0, pinfos);
+    auto copy = wstate;
+
+    copy.update_bhp(0, 123.0);
+    copy.wellRates(0)[0] = 42.0;
+    copy.wellPotentials(0)[0] = 17.0;
+    copy.update_bhp(1, 321.0);
+
+    copy.copyWellData(wstate, 0);
+    BOOST_CHECK_EQUAL(copy.bhp(0), wstate.bhp(0));
+    BOOST_CHECK_EQUAL(copy.wellRates(0)[0], wstate.wellRates(0)[0]);
+    BOOST_CHECK_EQUAL(copy.wellPotentials(0)[0], wstate.wellPotentials(0)[0]);
+
+    // other wells are left alone
+    BOOST_CHECK_EQUAL(copy.bhp(1), 321.0);
+}
+
 // ---------------------------------------------------------------------
 
 //BOOST_AUTO_TEST_CASE(GlobalWellInfo_TEST) {
@@ -488,6 +512,20 @@ BOOST_AUTO_TEST_CASE(TESTWellContainer) {
 
     auto wx = wci.well_index("WX");
     BOOST_CHECK(!wx.has_value());
+
+    // copies share the well names until one of them changes them
+    auto wcc = wci;
+    wcc.add("W4", 4);
+    wcc["W1"] = 10;
+    BOOST_CHECK_EQUAL(wcc.size(), 4);
+    BOOST_CHECK_EQUAL(wci.size(), 3);
+    BOOST_CHECK(!wci.has("W4"));
+    BOOST_CHECK_EQUAL(wci["W1"], 1);
+
+    auto wcd = wci;
+    wcd.clear();
+    BOOST_CHECK(wcd.empty());
+    BOOST_CHECK(wci.has("W1"));
 }
 
 BOOST_AUTO_TEST_CASE(TESTSegmentState) {